@@ -0,0 +1,339 @@
+#include "app_hal.h"
+#include "app.h"
+#include "display_stats.h"
+#include "refresh_governor.h"
+#include "display_scroll.h"
+#include "keypad.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef HEADLESS_RUN_MS
+#define HEADLESS_RUN_MS 1000
+#endif
+
+#ifndef HEADLESS_FRAME_FILE
+#define HEADLESS_FRAME_FILE "frame.ppm"
+#endif
+
+namespace hal {
+
+//
+// Keys, set by test script
+//
+
+static bool start_pressed = false;
+static void (*key_start_cb)(bool pressed) = NULL;
+
+bool key_start_on()
+{
+    return start_pressed;
+}
+
+void headless_key(uint32_t key, bool pressed)
+{
+    keypad_push(key, pressed);
+}
+
+void set_key_start_cb(void (*handler)(bool pressed))
+{
+    key_start_cb = handler;
+}
+
+void headless_start_key(bool pressed)
+{
+    if (pressed == start_pressed) return;
+
+    start_pressed = pressed;
+    if (key_start_cb) key_start_cb(pressed);
+}
+
+void headless_click(uint32_t key, uint32_t hold_ms)
+{
+    headless_key(key, true);
+    headless_run(hold_ms);
+    headless_key(key, false);
+    headless_run(50);
+}
+
+uint32_t micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+//
+// Display frame memory emulation, with hardware scroll, as in SDL2 HAL
+//
+
+static DisplayScroll disp_scroll;
+static lv_color_t disp_gram[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static uint16_t disp_frame[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static bool disp_on = true;
+static uint16_t backlight_duty = 0;
+
+static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    display_stats_flush_start(area);
+
+    lv_coord_t width = lv_area_get_width(area);
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(
+            &disp_gram[disp_scroll.map(y) * LV_HOR_RES_MAX + area->x1],
+            color_p,
+            width * sizeof(lv_color_t)
+        );
+        color_p += width;
+    }
+
+    display_stats_flush_end();
+    lv_disp_flush_ready(disp_drv);
+}
+
+bool display_scroll_area(int16_t top, int16_t height)
+{
+    disp_scroll.set_area(top, height);
+    return true;
+}
+
+void display_scroll(int16_t dy)
+{
+    disp_scroll.scroll(dy);
+}
+
+void display_power(bool on)
+{
+    disp_on = on;
+}
+
+void backlight(uint16_t duty)
+{
+    backlight_duty = duty;
+}
+
+uint16_t headless_backlight()
+{
+    return backlight_duty;
+}
+
+const uint16_t * headless_frame()
+{
+    for (lv_coord_t y = 0; y < LV_VER_RES_MAX; y++)
+    {
+        const lv_color_t * src = &disp_gram[disp_scroll.map(y) * LV_HOR_RES_MAX];
+        uint16_t * dst = &disp_frame[y * LV_HOR_RES_MAX];
+
+        for (lv_coord_t x = 0; x < LV_HOR_RES_MAX; x++) dst[x] = disp_on ? src[x].full : 0;
+    }
+
+    return disp_frame;
+}
+
+// CRC32 (IEEE) of frame pixels, little endian
+uint32_t headless_frame_crc()
+{
+    const uint16_t * frame = headless_frame();
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint32_t i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX * 2; i++)
+    {
+        crc ^= (i & 1) ? frame[i >> 1] >> 8 : frame[i >> 1] & 0xFF;
+
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+bool headless_frame_save(const char * path)
+{
+    const uint16_t * frame = headless_frame();
+    FILE * f = fopen(path, "wb");
+
+    if (!f) return false;
+
+    fprintf(f, "P6\n%d %d\n255\n", LV_HOR_RES_MAX, LV_VER_RES_MAX);
+
+    for (uint32_t i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX; i++)
+    {
+        uint16_t c = frame[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31)
+        };
+
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+
+    return fclose(f) == 0;
+}
+
+//
+// Virtual time. Hires timer runs at 1000 Hz, as in emulator.
+//
+
+static void (*hires_timer_cb)(void) = NULL;
+static uint32_t clock_ms = 0;
+static uint32_t handler_at = 0;
+static uint32_t handler_period = GOVERNOR_PERIOD_MIN;
+static uint32_t busy_us = 0;
+static uint32_t heap_peak = 0;
+static void (*heap_fail_cb)(uint32_t size) = NULL;
+
+static uint32_t heap_used()
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    return mon.total_size - mon.free_size;
+}
+
+void headless_heap_fail_cb(void (*handler)(uint32_t size))
+{
+    heap_fail_cb = handler;
+}
+
+} // namespace
+
+#ifdef HEADLESS_HEAP_WRAP
+
+// Linker redirects LVGL heap calls here (`--wrap`, see platformio.ini). So
+// peak is sampled inside any call, not only between `lv_task_handler()`
+// runs, and allocation failure is reported before NULL reaches app code.
+extern "C" void * __real_lv_mem_alloc(size_t size);
+extern "C" void * __real_lv_mem_realloc(void * data_p, size_t new_size);
+
+static void * heap_track(void * p, size_t size)
+{
+    if (!p && size && hal::heap_fail_cb) hal::heap_fail_cb(size);
+
+    hal::heap_peak = LV_MATH_MAX(hal::heap_peak, hal::heap_used());
+    return p;
+}
+
+extern "C" void * __wrap_lv_mem_alloc(size_t size)
+{
+    return heap_track(__real_lv_mem_alloc(size), size);
+}
+
+extern "C" void * __wrap_lv_mem_realloc(void * data_p, size_t new_size)
+{
+    return heap_track(__real_lv_mem_realloc(data_p, new_size), new_size);
+}
+
+#endif
+
+namespace hal {
+
+void set_hires_timer_cb(void (*handler)(void))
+{
+    hires_timer_cb = handler;
+}
+
+void headless_run(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++)
+    {
+        lv_tick_inc(1);
+        clock_ms++;
+
+        if (hires_timer_cb != NULL) hires_timer_cb();
+
+        if (clock_ms - handler_at < handler_period) continue;
+
+        handler_at = clock_ms;
+
+        uint32_t started_at = micros();
+        lv_task_handler();
+        uint32_t spent = micros() - started_at;
+
+        display_stats_handler(spent);
+        busy_us += spent;
+        heap_peak = LV_MATH_MAX(heap_peak, heap_used());
+
+        handler_period = refresh_governor_update();
+    }
+}
+
+uint32_t headless_time()
+{
+    return clock_ms;
+}
+
+uint32_t headless_busy_us()
+{
+    return busy_us;
+}
+
+uint32_t headless_heap_peak()
+{
+    return heap_peak;
+}
+
+void headless_heap_peak_reset()
+{
+    heap_peak = heap_used();
+}
+
+//
+// Hardware setup
+//
+
+void setup(void)
+{
+    static lv_disp_buf_t disp_buf;
+    static lv_color_t buf[LV_HOR_RES_MAX * 20];
+    lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * 20);
+
+    lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+
+    disp_drv.flush_cb = disp_flush;
+    disp_drv.monitor_cb = display_stats_monitor_cb;
+    disp_drv.buffer = &disp_buf;
+    lv_disp_drv_register(&disp_drv);
+
+    lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_KEYPAD;
+    indev_drv.read_cb = keypad_read;
+
+    app_data.kbd = lv_indev_drv_register(&indev_drv);
+}
+
+//
+// Main loop. Without test script, just render start screen for a while and
+// save it, to look at.
+//
+
+void loop(void)
+{
+    headless_run(HEADLESS_RUN_MS);
+
+    if (!headless_frame_save(HEADLESS_FRAME_FILE))
+    {
+        fprintf(stderr, "Can't write \"%s\"\n", HEADLESS_FRAME_FILE);
+        return;
+    }
+
+    printf("Frame saved to \"%s\", crc32: %08x\n", HEADLESS_FRAME_FILE, (unsigned)headless_frame_crc());
+}
+
+
+void StepperIO::to(uint16_t phase)
+{
+    (void)phase;
+}
+
+void StepperIO::off()
+{
+}
+
+
+} // namespace
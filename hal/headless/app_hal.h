@@ -0,0 +1,76 @@
+#ifndef __APP_HAL__
+#define __APP_HAL__
+
+// Headless HAL, for automated GUI tests. No window & no threads: display
+// renders into memory, LVGL clock is virtual and advances only in
+// `headless_run()`, keys are set by test script. So the same script always
+// gives the same frames.
+
+#include <stdint.h>
+// Settings in RAM, every run starts from defaults
+#include "../sdl2/eeprom_flash_driver.h"
+
+namespace hal {
+
+void setup();
+void loop();
+void set_hires_timer_cb(void (*handler)(void));
+bool key_start_on();
+// Start key press/release handler. Called at once, can be from interrupt.
+void set_key_start_cb(void (*handler)(bool pressed));
+// Microseconds counter, for profiling. Real time, not virtual.
+uint32_t micros();
+// LCD backlight PWM duty, 0..0xFFFF, linear. See `backlight.h`.
+void backlight(uint16_t duty);
+// Hardware vertical scroll of full-width rows band, see `display_scroll.h`.
+// Returns false if not supported.
+bool display_scroll_area(int16_t top, int16_t height);
+void display_scroll(int16_t dy);
+// Panel off & sleep mode, or back on. Frame memory is kept. Call with LVGL
+// refresh paused.
+void display_power(bool on);
+
+class StepperIO {
+public:
+    static void to(uint16_t phase);
+    static void off();
+};
+
+typedef EepromFlashDriver EepromDriver;
+
+//
+// Test controls
+//
+
+// Advance virtual time by `ms`, running LVGL tasks & hires timer as main
+// loop does.
+void headless_run(uint32_t ms);
+uint32_t headless_time();
+
+// Queue keypad key event (LV_KEY_...), or set dispense key state
+void headless_key(uint32_t key, bool pressed);
+void headless_start_key(bool pressed);
+// Press & release key, with time to process both
+void headless_click(uint32_t key, uint32_t hold_ms = 50);
+
+// What panel shows now: RGB565, LV_HOR_RES_MAX * LV_VER_RES_MAX, rows from
+// top. Black if panel is off.
+const uint16_t * headless_frame();
+uint32_t headless_frame_crc();
+uint16_t headless_backlight();
+// Write current frame as PPM image, returns false on error
+bool headless_frame_save(const char * path);
+
+// Real time, spent in `lv_task_handler()`, us
+uint32_t headless_busy_us();
+// Max LVGL heap use since reset. Sampled on every allocation when built
+// with HEADLESS_HEAP_WRAP (Linux), else after every `lv_task_handler()`.
+uint32_t headless_heap_peak();
+void headless_heap_peak_reset();
+// Called on LVGL allocation failure, before NULL is returned to caller.
+// HEADLESS_HEAP_WRAP only.
+void headless_heap_fail_cb(void (*handler)(uint32_t size));
+
+} // namespace
+
+#endif
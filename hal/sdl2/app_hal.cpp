@@ -1,10 +1,17 @@
 #define SDL_MAIN_HANDLED        /*To fix SDL's "undefined reference to WinMain" issue*/
 #include <SDL2/SDL.h>
 #include "display/monitor.h"
-#include "indev/keyboard.h"
 
 #include "app_hal.h"
 #include "app.h"
+#include "display_stats.h"
+#include "glyph_cache.h"
+#include "refresh_governor.h"
+#include "display_scroll.h"
+#include "keypad.h"
+#include "input_stats.h"
+
+#include <string.h>
 
 namespace hal {
 
@@ -17,41 +24,42 @@ void log(lv_log_level_t level, const char * file, uint32_t line, const char * ds
 #endif
 
 static bool key_space_pressed = false;
+static void (*key_start_cb)(bool pressed) = NULL;
 
-static bool my_keyboard_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+// Watch SDL key events, called at once from thread which polls SDL events.
+// Fast presses are queued, not merged by polling. Space replaces "dispense"
+// button.
+static int key_event_watch(void * userdata, SDL_Event * event)
 {
-    static int prev_state;
+    (void)userdata;
 
-    // Call original function
-    keyboard_read(indev_drv, data);
+    if (event->type != SDL_KEYDOWN && event->type != SDL_KEYUP) return 0;
+    // LVGL makes repeats itself
+    if (event->key.repeat) return 0;
 
-    // Translate space key state (replaces "dispence" button)
-    if (data->key == 0x20)
-    {
-        if (data->state == LV_INDEV_STATE_PR) key_space_pressed = true;
-        else key_space_pressed = false;
-    }
+    bool pressed = event->type == SDL_KEYDOWN;
 
-    //---------------------------------------------------------
-    // HACK! Send release codes to group, to compensate lack of
-    // existing ones
-    //---------------------------------------------------------
-    if (app_data.group)
+    switch (event->key.keysym.sym)
     {
-        // Spy data & inject events before continue
-        if (data->state == LV_INDEV_STATE_REL && prev_state == LV_INDEV_STATE_PR)
-        {
-            lv_obj_t * selected = lv_group_get_focused(app_data.group);
-            if (selected)
+        case SDLK_UP: keypad_push(LV_KEY_UP, pressed); break;
+        case SDLK_DOWN: keypad_push(LV_KEY_DOWN, pressed); break;
+        case SDLK_LEFT: keypad_push(LV_KEY_LEFT, pressed); break;
+        case SDLK_RIGHT: keypad_push(LV_KEY_RIGHT, pressed); break;
+        case SDLK_RETURN:
+        case SDLK_KP_ENTER:
+            keypad_push(LV_KEY_ENTER, pressed);
+            break;
+
+        case SDLK_SPACE:
+            if (pressed != key_space_pressed)
             {
-                lv_event_send(selected, HACK_EVENT_RELEASED, &data->key);
+                key_space_pressed = pressed;
+                if (key_start_cb) key_start_cb(pressed);
             }
-        }
+            break;
     }
 
-    prev_state = data->state;
-
-    return false;
+    return 0;
 }
 
 // State of "dispense" key.
@@ -60,6 +68,19 @@ bool key_start_on()
     return key_space_pressed;
 }
 
+void set_key_start_cb(void (*handler)(bool pressed))
+{
+    key_start_cb = handler;
+}
+
+uint32_t micros()
+{
+    uint64_t cnt = SDL_GetPerformanceCounter();
+    uint64_t freq = SDL_GetPerformanceFrequency();
+
+    return (uint32_t)((cnt / freq) * 1000000 + (cnt % freq) * 1000000 / freq);
+}
+
 #if MEM_USE_LOG != 0
 static void sysmon_task(lv_task_t * param)
 {
@@ -77,9 +98,107 @@ static void sysmon_task(lv_task_t * param)
         (int)mem_used_pct,
         (int)(mem_mon.total_size - mem_mon.free_size)
     );
+
+    saver_stats_t & saver = app_data.saver_stats;
+
+    printf(
+        "[Saver] queue: %d, deferred: %d, deadline flushes: %d, flushes: %d\n",
+        (int)saver.queue_depth,
+        (int)saver.deferrals,
+        (int)saver.deadline_flushes,
+        (int)saver.flushes
+    );
+
+    eeprom_stats_t & ee = app_data.eeprom_stats;
+    uint32_t ee_total = ee.user_bytes + ee.compaction_bytes;
+
+    printf(
+        "[Eeprom] generation: %d, erases: %d, user: %d bytes, compaction: %d bytes, amplification: %d%%\n",
+        (int)ee.generation,
+        (int)ee.erases,
+        (int)ee.user_bytes,
+        (int)ee.compaction_bytes,
+        ee.user_bytes ? (int)(ee_total * 100 / ee.user_bytes) : 0
+    );
+
+    display_stats_print("\n");
+    glyph_cache_print("\n");
+    refresh_governor_print("\n");
+    input_stats_print("\n");
 }
 #endif
 
+//
+// Display frame memory emulation, with hardware scroll. Flushed rows are
+// remapped as on device, and the whole screen is shown from memory. So
+// scroll bugs are visible in emulator too.
+//
+
+static DisplayScroll disp_scroll;
+static lv_color_t disp_gram[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static lv_color_t disp_frame[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static bool disp_on = true;
+
+// Show frame memory, or black screen if panel is off
+static void disp_present(lv_disp_drv_t * disp_drv)
+{
+    for (lv_coord_t y = 0; y < LV_VER_RES_MAX; y++)
+    {
+        if (!disp_on)
+        {
+            memset(&disp_frame[y * LV_HOR_RES_MAX], 0, LV_HOR_RES_MAX * sizeof(lv_color_t));
+            continue;
+        }
+
+        memcpy(
+            &disp_frame[y * LV_HOR_RES_MAX],
+            &disp_gram[disp_scroll.map(y) * LV_HOR_RES_MAX],
+            LV_HOR_RES_MAX * sizeof(lv_color_t)
+        );
+    }
+
+    lv_area_t screen = { 0, 0, LV_HOR_RES_MAX - 1, LV_VER_RES_MAX - 1 };
+    monitor_flush(disp_drv, &screen, disp_frame);
+}
+
+static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    display_stats_flush_start(area);
+
+    lv_coord_t width = lv_area_get_width(area);
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(
+            &disp_gram[disp_scroll.map(y) * LV_HOR_RES_MAX + area->x1],
+            color_p,
+            width * sizeof(lv_color_t)
+        );
+        color_p += width;
+    }
+
+    disp_present(disp_drv);
+
+    display_stats_flush_end();
+}
+
+bool display_scroll_area(int16_t top, int16_t height)
+{
+    disp_scroll.set_area(top, height);
+    return true;
+}
+
+void display_scroll(int16_t dy)
+{
+    disp_scroll.scroll(dy);
+}
+
+void display_power(bool on)
+{
+    disp_on = on;
+    disp_present(&lv_disp_get_default()->driver);
+}
+
 
 static int tick_thread(void * data)
 {
@@ -139,7 +258,8 @@ void setup(void)
     lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
 
-    disp_drv.flush_cb = monitor_flush;
+    disp_drv.flush_cb = disp_flush;
+    disp_drv.monitor_cb = display_stats_monitor_cb;
     disp_drv.buffer = &disp_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -147,11 +267,11 @@ void setup(void)
     // Init keyboard
     //
 
-    keyboard_init();
+    SDL_AddEventWatch(key_event_watch, NULL);
     lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv.read_cb = my_keyboard_read;
+    indev_drv.read_cb = keypad_read;
 
     app_data.kbd = lv_indev_drv_register(&indev_drv);
 
@@ -174,10 +294,16 @@ void setup(void)
 
 void loop(void)
 {
-    // Loop
+    uint32_t period = GOVERNOR_PERIOD_MIN;
+
     while(1) {
-        SDL_Delay(5);
+        SDL_Delay(period);
+
+        uint32_t started_at = micros();
         lv_task_handler();
+        display_stats_handler(micros() - started_at);
+
+        period = refresh_governor_update();
     }
 }
 
@@ -188,22 +314,24 @@ void loop(void)
 //
 // 0, 1, 2, 3 - respond to desired rotor position in full step wave mode
 //
+// No motor in emulator. Called on every hires timer tick, so nothing is
+// logged, to not flood console.
+//
 
 void StepperIO::to(uint16_t phase)
 {
-    printf("motor: phase %d", phase);
+    (void)phase;
 }
 
 void StepperIO::off()
 {
-    printf("motor: off");
 }
 
 
-// Enable/Disable LCD backlight. Do nothing in emulator
-void backlight(bool on)
+// Set LCD backlight PWM duty. Do nothing in emulator
+void backlight(uint16_t duty)
 {
-    (void)on;
+    (void)duty;
 }
 
 
@@ -2,6 +2,7 @@
 #define __APP_HAL__
 
 #include <stdint.h>
+#include "eeprom_flash_driver_file.h"
 
 namespace hal {
 
@@ -9,7 +10,19 @@ void setup();
 void loop();
 void set_hires_timer_cb(void (*handler)(void));
 bool key_start_on();
-void backlight(bool on);
+// Start key press/release handler. Called at once, can be from interrupt.
+void set_key_start_cb(void (*handler)(bool pressed));
+// Microseconds counter, for profiling. Wraps in ~71 min.
+uint32_t micros();
+// LCD backlight PWM duty, 0..0xFFFF, linear. See `backlight.h`.
+void backlight(uint16_t duty);
+// Hardware vertical scroll of full-width rows band, see `display_scroll.h`.
+// Returns false if not supported.
+bool display_scroll_area(int16_t top, int16_t height);
+void display_scroll(int16_t dy);
+// Panel off & sleep mode, or back on. Frame memory is kept. Call with LVGL
+// refresh paused.
+void display_power(bool on);
 
 class StepperIO {
 public:
@@ -17,6 +30,14 @@ public:
     static void off();
 };
 
+#ifdef EEPROM_FLASH_DRIVER_FILE
+// Settings are stored in image file, to persist between runs
+typedef EepromFlashDriverFile EepromDriver;
+#else
+// No mmap on this host, settings are kept in RAM until exit
+typedef EepromFlashDriver EepromDriver;
+#endif
+
 } // namespace
 
 #endif
@@ -14,8 +14,16 @@ public:
     }
 
     static const uint32_t BankSize = EEPROM_EMU_BANK_SIZE;
+    static const uint32_t ProgramSize = 2;
+    static const uint32_t MemoryMapped = 1;
 
-    uint8_t memory[BankSize*2];
+    // Aligned, to allow word access via pointers
+    alignas(8) uint8_t memory[BankSize*2];
+
+    const uint8_t * bank_ptr(uint8_t bank) { return memory + bank*BankSize; }
+
+    void unlock() {}
+    void lock() {}
 
     void erase(uint8_t bank)
     {
@@ -36,6 +44,12 @@ public:
         memory[ofs] = (uint8_t)data & 0xFF;
         memory[ofs+1] = (uint8_t)(data >> 8) & 0xFF;
     }
+
+    void write_u32(uint8_t bank, uint32_t addr, uint32_t data)
+    {
+        write_u16(bank, addr, data & 0xFFFF);
+        write_u16(bank, addr + 2, (uint16_t)(data >> 16));
+    }
 };
 
 #endif
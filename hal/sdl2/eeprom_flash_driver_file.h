@@ -0,0 +1,166 @@
+#ifndef __EEPROM_FLASH_DRIVER_FILE__
+#define __EEPROM_FLASH_DRIVER_FILE__
+
+// Emulator flash driver, with both banks in memory-mapped image file. So
+// settings persist between runs, and flash dumps from devices can be used
+// as is (bank 0, then bank 1).
+//
+// Like real flash, program can only clear bits (1 -> 0), and erase sets the
+// whole bank to 0xFF.
+//
+// Image path is `EEPROM_EMU_FILE` environment variable, or the same define,
+// or "eeprom.bin". File is mapped on first access, if `open()` not called.
+//
+// Needs POSIX mmap. Defines EEPROM_FLASH_DRIVER_FILE where available, other
+// hosts should use in-RAM `EepromFlashDriver`.
+
+#include "eeprom_flash_driver.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define EEPROM_FLASH_DRIVER_FILE 1
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef EEPROM_EMU_FILE
+#define EEPROM_EMU_FILE "eeprom.bin"
+#endif
+
+class EepromFlashDriverFile
+{
+    uint8_t * memory = NULL;
+
+    void map()
+    {
+        if (memory) return;
+
+        const char * path = getenv("EEPROM_EMU_FILE");
+        open(path ? path : EEPROM_EMU_FILE);
+    }
+
+public:
+    static const uint32_t BankSize = EEPROM_EMU_BANK_SIZE;
+    static const uint32_t ProgramSize = 2;
+    static const uint32_t MemoryMapped = 1;
+
+    EepromFlashDriverFile() {}
+    EepromFlashDriverFile(const EepromFlashDriverFile &) = delete;
+    EepromFlashDriverFile & operator=(const EepromFlashDriverFile &) = delete;
+
+    ~EepromFlashDriverFile() { close(); }
+
+    // Map image file. New or short file is padded with 0xFF (erased). On
+    // error, anonymous memory is used and data will not persist.
+    bool open(const char * path)
+    {
+        const uint32_t size = BankSize*2;
+
+        close();
+
+        int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+        struct stat st;
+        void * ptr = MAP_FAILED;
+
+        if (fd >= 0 && fstat(fd, &st) == 0)
+        {
+            uint8_t erased[256];
+            memset(erased, 0xFF, sizeof(erased));
+
+            bool ok = true;
+
+            for (uint32_t ofs = (uint32_t)st.st_size; ok && ofs < size;)
+            {
+                uint32_t len = size - ofs < sizeof(erased) ? size - ofs : sizeof(erased);
+
+                ok = pwrite(fd, erased, len, ofs) == (ssize_t)len;
+                ofs += len;
+            }
+
+            if (ok) ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+
+        // Mapping stays valid after descriptor close
+        if (fd >= 0) ::close(fd);
+
+        if (ptr != MAP_FAILED)
+        {
+            memory = (uint8_t *)ptr;
+            return true;
+        }
+
+        fprintf(stderr, "EEPROM: can't map \"%s\", data will not persist\n", path);
+
+        ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        // No memory at all, nothing to fall back to
+        if (ptr == MAP_FAILED)
+        {
+            fprintf(stderr, "EEPROM: can't allocate %u bytes\n", (unsigned)size);
+            abort();
+        }
+
+        memory = (uint8_t *)ptr;
+        memset(memory, 0xFF, size);
+        return false;
+    }
+
+    void close()
+    {
+        if (!memory) return;
+
+        msync(memory, BankSize*2, MS_SYNC);
+        munmap(memory, BankSize*2);
+        memory = NULL;
+    }
+
+    const uint8_t * bank_ptr(uint8_t bank)
+    {
+        map();
+        return memory + bank*BankSize;
+    }
+
+    void unlock() { map(); }
+    void lock() {}
+
+    void erase(uint8_t bank)
+    {
+        map();
+        memset(memory + bank*BankSize, 0xFF, BankSize);
+    }
+
+    uint16_t read_u16(uint8_t bank, uint32_t addr)
+    {
+        map();
+
+        uint32_t ofs = bank*BankSize + addr;
+
+        return uint16_t(memory[ofs] + (memory[ofs+1] << 8));
+    }
+
+    // Program clears bits only, as real flash does
+    void write_u16(uint8_t bank, uint32_t addr, uint16_t data)
+    {
+        map();
+
+        uint32_t ofs = bank*BankSize + addr;
+
+        memory[ofs] &= (uint8_t)(data & 0xFF);
+        memory[ofs+1] &= (uint8_t)(data >> 8);
+    }
+
+    void write_u32(uint8_t bank, uint32_t addr, uint32_t data)
+    {
+        write_u16(bank, addr, data & 0xFFFF);
+        write_u16(bank, addr + 2, (uint16_t)(data >> 16));
+    }
+};
+
+#endif // __unix__ || __APPLE__
+
+#endif
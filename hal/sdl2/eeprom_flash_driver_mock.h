@@ -0,0 +1,112 @@
+#ifndef __EEPROM_FLASH_DRIVER_MOCK__
+#define __EEPROM_FLASH_DRIVER_MOCK__
+
+// Flash driver for tests & benchmarks. Counts operations per bank, checks
+// that every cell is programmed once between erases, and can emulate power
+// loss after N halfword programs.
+//
+// Not memory-mapped by default, to count reads. With `MAPPED` = 1 records
+// are read via pointers and `reads` stay zero.
+
+#include "eeprom_flash_driver.h"
+
+template <uint32_t PROGRAM_SIZE = 2, uint32_t MAPPED = 0>
+class EepromFlashDriverMock : public EepromFlashDriver
+{
+    uint32_t halfwords_left = UINT32_MAX;
+
+public:
+    static const uint32_t ProgramSize = PROGRAM_SIZE;
+    static const uint32_t MemoryMapped = MAPPED;
+
+    struct Stats {
+        uint32_t reads = 0;
+        uint32_t programs = 0;      // program operations, in ProgramSize units
+        uint32_t halfwords = 0;     // programmed halfwords
+        uint32_t erases = 0;
+    };
+
+    Stats stats[2];
+
+    // Attempts to program cells, which are not erased. Should stay 0.
+    uint32_t program_errors = 0;
+
+    // Number of unlock() calls, to check batching
+    uint32_t unlocks = 0;
+
+    // After `n` more halfwords programmed, all next operations are ignored.
+    void power_cut_after(uint32_t n) { halfwords_left = n; }
+
+    bool power_lost() { return halfwords_left == 0; }
+
+    void reset_stats()
+    {
+        stats[0] = Stats();
+        stats[1] = Stats();
+        program_errors = 0;
+        unlocks = 0;
+    }
+
+    Stats total()
+    {
+        Stats t;
+        t.reads = stats[0].reads + stats[1].reads;
+        t.programs = stats[0].programs + stats[1].programs;
+        t.halfwords = stats[0].halfwords + stats[1].halfwords;
+        t.erases = stats[0].erases + stats[1].erases;
+        return t;
+    }
+
+    void unlock() { unlocks++; }
+    void lock() {}
+
+    void erase(uint8_t bank)
+    {
+        if (power_lost()) return;
+
+        stats[bank].erases++;
+        EepromFlashDriver::erase(bank);
+    }
+
+    uint16_t read_u16(uint8_t bank, uint32_t addr)
+    {
+        stats[bank].reads++;
+        return EepromFlashDriver::read_u16(bank, addr);
+    }
+
+    void write_u16(uint8_t bank, uint32_t addr, uint16_t data)
+    {
+        if (!power_lost()) stats[bank].programs++;
+
+        program_halfword(bank, addr, data);
+    }
+
+    // Wide units are programmed by halfwords from lower address, like STM32F0
+    // does. So power loss can leave unit partially written.
+    void write_u32(uint8_t bank, uint32_t addr, uint32_t data)
+    {
+        if (!power_lost()) stats[bank].programs++;
+
+        program_halfword(bank, addr, data & 0xFFFF);
+        program_halfword(bank, addr + 2, (uint16_t)(data >> 16));
+    }
+
+private:
+    void program_halfword(uint8_t bank, uint32_t addr, uint16_t data)
+    {
+        if (power_lost()) return;
+
+        halfwords_left--;
+        stats[bank].halfwords++;
+
+        if (EepromFlashDriver::read_u16(bank, addr) != 0xFFFF)
+        {
+            program_errors++;
+            return;
+        }
+
+        EepromFlashDriver::write_u16(bank, addr, data);
+    }
+};
+
+#endif
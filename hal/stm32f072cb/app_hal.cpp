@@ -1,6 +1,7 @@
 #include "app.h"
 #include "app_hal.h"
 #include "etl/debounce.h"
+#include "edge_debounce.h"
 
 #include "main.h"
 #include "adc.h"
@@ -11,10 +12,25 @@
 
 #include "lvgl.h"
 #include "st7735.h"
+#include "display_stats.h"
+#include "glyph_cache.h"
+#include "refresh_governor.h"
+#include "input_stats.h"
+#include "keypad.h"
 #include "stdio_retarget.h"
 
 extern "C" void SystemClock_Config(void);
 
+// Display buffers. With double buffering LVGL renders next strip, while DMA
+// sends previous one. RAM use is the same as for single 20-lines buffer.
+#define DISP_DOUBLE_BUFFER 1
+
+#if DISP_DOUBLE_BUFFER
+#define DISP_BUF_LINES 10
+#else
+#define DISP_BUF_LINES 20
+#endif
+
 #if MEM_USE_LOG != 0
 #include "stdio.h"
 static void sysmon_task(lv_task_t * param)
@@ -33,87 +49,92 @@ static void sysmon_task(lv_task_t * param)
         (int)mem_used_pct,
         (int)(mem_mon.total_size - mem_mon.free_size)
     );
+
+    saver_stats_t & saver = app_data.saver_stats;
+
+    printf(
+        "[Saver] queue: %d, deferred: %d, deadline flushes: %d, flushes: %d\r\n",
+        (int)saver.queue_depth,
+        (int)saver.deferrals,
+        (int)saver.deadline_flushes,
+        (int)saver.flushes
+    );
+
+    eeprom_stats_t & ee = app_data.eeprom_stats;
+    uint32_t ee_total = ee.user_bytes + ee.compaction_bytes;
+
+    printf(
+        "[Eeprom] generation: %d, erases: %d, user: %d bytes, compaction: %d bytes, amplification: %d%%\r\n",
+        (int)ee.generation,
+        (int)ee.erases,
+        (int)ee.user_bytes,
+        (int)ee.compaction_bytes,
+        ee.user_bytes ? (int)(ee_total * 100 / ee.user_bytes) : 0
+    );
+
+    // Counters are updated from SPI interrupts
+    __disable_irq();
+    uint32_t window_skips = ST7735_stats.window_skips;
+    ST7735_stats.window_skips = 0;
+    __enable_irq();
+
+    printf(
+        "[Display] %s buffer, %d window skips\r\n",
+        DISP_DOUBLE_BUFFER ? "double" : "single",
+        (int)window_skips
+    );
+
+    display_stats_print("\r\n");
+    glyph_cache_print("\r\n");
+    refresh_governor_print("\r\n");
+    input_stats_print("\r\n");
 }
 #endif
 
 namespace hal {
 
 // Key debouncers, protect from jitter
-static etl::debounce<3> key_up, key_down, key_left, key_right, key_enter, key_start;
+static etl::debounce<3> key_up, key_down, key_left, key_right, key_enter;
 
-static uint32_t kbd_last_key = 0;
-static lv_indev_state_t kbd_last_state;
+// Start key reacts on the first edge (EXTI), and ignores bounce for 20ms
+// after, in hires timer ticks.
+static EdgeDebounce key_start(200);
+static void (*key_start_cb)(bool pressed) = NULL;
 
 static lv_disp_drv_t disp_drv;
 
-// Scan keys every 10ms.
-static void key_scan_task(lv_task_t * task)
+static bool key_event(etl::debounce<3> & key, uint32_t code)
 {
-        // Forwars button pins to debouncers
-        key_down.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13));
-        key_up.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_15));
-        key_right.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_14));
-        key_left.add(HAL_GPIO_ReadPin(GPIOF, GPIO_PIN_0));
-        key_enter.add(HAL_GPIO_ReadPin(GPIOF, GPIO_PIN_1));
-        key_start.add(HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_8));
-
-        // Record data for indev reader the same way as in emulator.
-        // In theory, events should be queued, but currently LVGL allows only.
-        // single press/release event at each moment.
-        if (key_up.has_changed())
-        {
-            if (key_up.is_set()) { kbd_last_key = LV_KEY_UP; kbd_last_state = LV_INDEV_STATE_PR; }
-            else kbd_last_state = LV_INDEV_STATE_REL;
-        }
-        if (key_left.has_changed())
-        {
-            if (key_left.is_set()) { kbd_last_key = LV_KEY_LEFT; kbd_last_state = LV_INDEV_STATE_PR; }
-            else kbd_last_state = LV_INDEV_STATE_REL;
-        }
-        if (key_down.has_changed())
-        {
-            if (key_down.is_set()) { kbd_last_key = LV_KEY_DOWN; kbd_last_state = LV_INDEV_STATE_PR; }
-            else kbd_last_state = LV_INDEV_STATE_REL;
-        }
-        if (key_right.has_changed())
-        {
-            if (key_right.is_set()) { kbd_last_key = LV_KEY_RIGHT; kbd_last_state = LV_INDEV_STATE_PR; }
-            else kbd_last_state = LV_INDEV_STATE_REL;
-        }
-        if (key_enter.has_changed())
-        {
-            if (key_enter.is_set()) { kbd_last_key = LV_KEY_ENTER; kbd_last_state = LV_INDEV_STATE_PR; }
-            else kbd_last_state = LV_INDEV_STATE_REL;
-        }
-}
+    if (!key.has_changed()) return false;
 
-static bool my_keyboard_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
-{
-    static int prev_state;
-    // Load prepared data
-    data->state = kbd_last_state;
-    data->key = kbd_last_key;
-
-    //---------------------------------------------------------
-    // HACK! Send release codes to group, to compensate lack of
-    // existing ones
-    //---------------------------------------------------------
-    if (app_data.group)
-    {
-        // Spy data & inject events before continue
-        if (data->state == LV_INDEV_STATE_REL && prev_state == LV_INDEV_STATE_PR)
-        {
-            lv_obj_t * selected = lv_group_get_focused(app_data.group);
-            if (selected)
-            {
-                lv_event_send(selected, HACK_EVENT_RELEASED, &data->key);
-            }
-        }
-    }
+    keypad_push(code, key.is_set());
+    return true;
+}
 
-    prev_state = data->state;
+// Set by key scan, main loop passes events to LVGL without waiting period
+static volatile bool key_scan_changed = false;
 
-    return false;
+// Scan keys every 10ms, from 1ms timer interrupt. So debounce time does not
+// depend on main loop period, which grows when idle.
+static void key_scan()
+{
+    // Forward button pins to debouncers
+    key_down.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13));
+    key_up.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_15));
+    key_right.add(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_14));
+    key_left.add(HAL_GPIO_ReadPin(GPIOF, GPIO_PIN_0));
+    key_enter.add(HAL_GPIO_ReadPin(GPIOF, GPIO_PIN_1));
+
+    // Queue changes with timestamps, LVGL reads those one by one
+    bool changed = false;
+
+    changed |= key_event(key_up, LV_KEY_UP);
+    changed |= key_event(key_left, LV_KEY_LEFT);
+    changed |= key_event(key_down, LV_KEY_DOWN);
+    changed |= key_event(key_right, LV_KEY_RIGHT);
+    changed |= key_event(key_enter, LV_KEY_ENTER);
+
+    if (changed) key_scan_changed = true;
 }
 
 // State of "dispense" key.
@@ -122,6 +143,39 @@ bool key_start_on()
     return key_start.is_set();
 }
 
+void set_key_start_cb(void (*handler)(bool pressed))
+{
+    key_start_cb = handler;
+}
+
+// Called from EXTI & hires timer interrupts, both have the same priority
+static void key_start_update(bool edge)
+{
+    bool level = HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_8) == GPIO_PIN_SET;
+
+    if (!(edge ? key_start.edge(level) : key_start.tick(level))) return;
+
+    if (level) input_stats_start_press(micros());
+    if (key_start_cb) key_start_cb(level);
+}
+
+uint32_t micros()
+{
+    uint32_t ms, ticks;
+
+    // Repeat if ms tick changed while reading SysTick counter
+    do {
+        ms = HAL_GetTick();
+        ticks = SysTick->LOAD - SysTick->VAL;
+    } while (ms != HAL_GetTick());
+
+    // In interrupts with priority above SysTick, counter could wrap while
+    // ms tick is not updated yet
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && ticks < SysTick->LOAD / 2) ms++;
+
+    return ms * 1000 + ticks / (SystemCoreClock / 1000000);
+}
+
 
 //
 // HiRes timer to create software PWM-s.
@@ -146,12 +200,18 @@ void setup(void)
 
     // Attach display buffer and display driver
     static lv_disp_buf_t disp_buf;
-    static lv_color_t buf[LV_HOR_RES_MAX * 20];
-    lv_disp_buf_init(&disp_buf, buf, NULL, LV_HOR_RES_MAX * 20);
+    static lv_color_t buf1[LV_HOR_RES_MAX * DISP_BUF_LINES];
+#if DISP_DOUBLE_BUFFER
+    static lv_color_t buf2[LV_HOR_RES_MAX * DISP_BUF_LINES];
+    lv_disp_buf_init(&disp_buf, buf1, buf2, LV_HOR_RES_MAX * DISP_BUF_LINES);
+#else
+    lv_disp_buf_init(&disp_buf, buf1, NULL, LV_HOR_RES_MAX * DISP_BUF_LINES);
+#endif
 
     lv_disp_drv_init(&disp_drv);
 
     disp_drv.flush_cb = ST7735_flush_cb;
+    disp_drv.monitor_cb = display_stats_monitor_cb;
     disp_drv.buffer = &disp_buf;
 
     ST7735_Init(&hspi1, &disp_drv);
@@ -165,14 +225,15 @@ void setup(void)
     lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_KEYPAD;
-    indev_drv.read_cb = my_keyboard_read;
+    indev_drv.read_cb = keypad_read;
 
     app_data.kbd = lv_indev_drv_register(&indev_drv);
-    lv_task_create(key_scan_task, 10, LV_TASK_PRIO_HIGHEST, NULL);
 
     MX_ADC_Init();
     MX_TIM7_Init();
     MX_TIM6_Init();
+    // Backlight PWM, ~20kHz. Starts with 0 duty (off)
+    MX_TIM17_Init();
 
     stdio_retarget_init();
 
@@ -182,6 +243,7 @@ void setup(void)
 
     HAL_TIM_Base_Start_IT(&htim6);
     HAL_TIM_Base_Start_IT(&htim7);
+    HAL_TIM_PWM_Start(&htim17, TIM_CHANNEL_1);
 }
 
 //
@@ -191,16 +253,32 @@ void setup(void)
 void loop(void)
 {
     uint32_t tick_start = HAL_GetTick();
+    uint32_t period = GOVERNOR_PERIOD_MIN;
 
     while(1) {
         uint32_t tick_current = HAL_GetTick();
+        bool keys = key_scan_changed;
 
-        if (tick_current - tick_start >= 5)
+        if (keys || tick_current - tick_start >= period)
         {
-            // Call ~ every 5ms
             tick_start = tick_current;
-        	lv_task_handler();
+
+            // Let LVGL take key events in this loop, instead of waiting
+            // read period
+            if (keys)
+            {
+                key_scan_changed = false;
+                lv_task_ready(app_data.kbd->driver.read_task);
+            }
+
+            uint32_t started_at = micros();
+            lv_task_handler();
+            display_stats_handler(micros() - started_at);
+
+            period = refresh_governor_update();
         }
+        // Sleep until next interrupt (SysTick at least)
+        else __WFI();
     }
 }
 
@@ -214,6 +292,16 @@ void loop(void)
 
 void StepperIO::to(uint16_t phase)
 {
+    // Coils of new position => motor starts move. The same phase is repeated
+    // by PWM.
+    static uint16_t last_phase = 0;
+
+    if (phase != last_phase)
+    {
+        last_phase = phase;
+        input_stats_coil_on();
+    }
+
     off(); // clrear previous
 
     switch (phase & 0x3)
@@ -243,10 +331,30 @@ void StepperIO::off()
 }
 
 
-// Enable/Disable LCD backlight
-void backlight(bool on)
+// Set LCD backlight PWM duty, 0 - off, 0xFFFF - full on. Compare value of
+// ARR + 1 keeps output always on.
+void backlight(uint16_t duty)
+{
+    uint32_t ccr = ((uint32_t)duty * (htim17.Init.Period + 1) + 0x8000) >> 16;
+
+    __HAL_TIM_SET_COMPARE(&htim17, TIM_CHANNEL_1, ccr);
+}
+
+
+bool display_scroll_area(int16_t top, int16_t height)
 {
-    HAL_GPIO_WritePin(GPIOB, GPIO_PIN_9, on ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    ST7735_SetScrollArea(top, height);
+    return true;
+}
+
+void display_scroll(int16_t dy)
+{
+    ST7735_Scroll(dy);
+}
+
+void display_power(bool on)
+{
+    ST7735_SetSleep(!on);
 }
 
 
@@ -256,12 +364,28 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
     if (htim->Instance == TIM7)
     {
-        // HiRes (100 uS) timer
+        // HiRes (100 uS) timer. Start key is checked first, to pass command
+        // to motor in the same tick.
+        hal::key_start_update(false);
         if (hal::hires_timer_cb) hal::hires_timer_cb();
     }
     else if (htim->Instance == TIM6)
     {
         // 1 mS timer
         lv_tick_inc(1);
+
+        static uint8_t key_scan_ticks = 0;
+
+        if (++key_scan_ticks >= 10)
+        {
+            key_scan_ticks = 0;
+            hal::key_scan();
+        }
     }
 }
+
+// Start key pin edge
+void HAL_GPIO_EXTI_Callback(uint16_t pin)
+{
+    if (pin == GPIO_PIN_8) hal::key_start_update(true);
+}
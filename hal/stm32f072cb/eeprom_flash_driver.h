@@ -13,6 +13,23 @@ class EepromFlashDriver
 public:
     enum { BankSize = EEPROM_EMU_BANK_SIZE };
 
+    // F0 flash has no ECC and programs halfwords internally. Word access
+    // halves HAL calls per record, but programmed data & wear stay the same.
+    // Commit mark is still written last.
+    enum { ProgramSize = 4 };
+
+    // Flash is memory-mapped, allow direct records scan via pointers
+    enum { MemoryMapped = 1 };
+
+    const uint8_t * bank_ptr(uint8_t bank)
+    {
+        return (const uint8_t *)(EEPROM_EMU_FLASH_START + bank*EEPROM_EMU_BANK_SIZE);
+    }
+
+    // Unlock once per records group, instead of every single write
+    void unlock() { HAL_FLASH_Unlock(); }
+    void lock() { HAL_FLASH_Lock(); }
+
     void erase(uint8_t bank)
     {
         FLASH_EraseInitTypeDef s_eraseinit;
@@ -21,12 +38,10 @@ public:
         s_eraseinit.NbPages     = EEPROM_EMU_BANK_SIZE / FLASH_PAGE_SIZE;
         uint32_t page_error = 0;
 
-        HAL_FLASH_Unlock();
         HAL_FLASHEx_Erase(&s_eraseinit, &page_error);
-        HAL_FLASH_Lock();
     }
 
-    uint16_t read_u16(uint8_t bank, uint16_t addr)
+    uint16_t read_u16(uint8_t bank, uint32_t addr)
     {
         void *flash_ptr = (void *)(EEPROM_EMU_FLASH_START + bank*EEPROM_EMU_BANK_SIZE + addr);
 
@@ -38,13 +53,18 @@ public:
         return *(uint16_t *)flash_ptr;
     }
 
-    void write_u16(uint8_t bank, uint16_t addr, uint16_t data)
+    void write_u16(uint8_t bank, uint32_t addr, uint16_t data)
     {
         uint32_t flash_addr = EEPROM_EMU_FLASH_START + bank*EEPROM_EMU_BANK_SIZE + addr;
 
-        HAL_FLASH_Unlock();
         HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, flash_addr, data);
-        HAL_FLASH_Lock();
+    }
+
+    void write_u32(uint8_t bank, uint32_t addr, uint32_t data)
+    {
+        uint32_t flash_addr = EEPROM_EMU_FLASH_START + bank*EEPROM_EMU_BANK_SIZE + addr;
+
+        HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, flash_addr, data);
     }
 };
 
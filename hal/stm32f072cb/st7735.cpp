@@ -1,5 +1,7 @@
 #include "stm32f0xx_hal.h"
 #include "st7735.h"
+#include "display_stats.h"
+#include "display_scroll.h"
 
 // Scanning direction of frame memory,
 // X-mirror and Y-mirror, set bits
@@ -25,21 +27,29 @@
 // Display resolution
 #define WIDTH  80
 #define HEIGHT 160
+// Frame memory rows, for scroll setup
+#define GRAM_HEIGHT 162
 
 // Control commands codes by datasheet
 #define CMD_SWRESET 0x01
+#define CMD_SLPIN   0x10
 #define CMD_SLPOUT  0x11
 #define CMD_INVON   0x21
+#define CMD_DISPOFF 0x28
 #define CMD_DISPON  0x29
 #define CMD_CASET   0x2A
 #define CMD_RASET   0x2B
 #define CMD_RAMWR   0x2C
 #define CMD_COLMOD  0x3A
+#define CMD_VSCRDEF 0x33
 #define CMD_MADCTL  0x36
+#define CMD_VSCRSADD 0x37
 
 static SPI_HandleTypeDef *hspi;
 static lv_disp_drv_t *disp_drv;
 
+ST7735_Stats ST7735_stats;
+
 // Send 1-byte command to display
 static void ST7735_WriteCommand(uint8_t cmd)
 {
@@ -47,13 +57,6 @@ static void ST7735_WriteCommand(uint8_t cmd)
     HAL_SPI_Transmit(hspi, &cmd, sizeof(cmd), HAL_MAX_DELAY);
 }
 
-// Send data to display (non-DMA)
-static void ST7735_WriteData(uint8_t* buff, size_t buff_size)
-{
-    HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
-    HAL_SPI_Transmit(hspi, buff, buff_size, HAL_MAX_DELAY);
-}
-
 // Send 1 byte data to display
 static void ST7735_WriteByteData(uint8_t byte)
 {
@@ -61,24 +64,6 @@ static void ST7735_WriteByteData(uint8_t byte)
   HAL_SPI_Transmit(hspi, &byte, 1, HAL_MAX_DELAY);
 }
 
-// Set address window in display frame memory for given coordinates
-static void ST7735_SetAddressWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
-{
-    // Set column address
-    uint8_t data[] = { 0x00, (uint8_t)(x0 + XSTART), 0x00, (uint8_t)(x1 + XSTART) };
-    ST7735_WriteCommand(CMD_CASET);
-    ST7735_WriteData(data, sizeof(data));
-
-    // Set row address
-    data[1] = y0 + YSTART;
-    data[3] = y1 + YSTART;
-    ST7735_WriteCommand(CMD_RASET);
-    ST7735_WriteData(data, sizeof(data));
-
-    // Enable write to RAM mode
-    ST7735_WriteCommand(CMD_RAMWR);
-}
-
 // ST7735 display initialization sequence
 void ST7735_Init(SPI_HandleTypeDef *p_hspi, lv_disp_drv_t *p_disp_drv)
 {
@@ -109,20 +94,283 @@ void ST7735_Init(SPI_HandleTypeDef *p_hspi, lv_disp_drv_t *p_disp_drv)
     ST7735_WriteCommand(CMD_DISPON);
 }
 
-// Flush lvgl buffer to display memory by DMA transfer
-void ST7735_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+//
+// Flush pipeline. Commands & window params are sent with interrupts, pixels
+// with DMA, as 16-bit frames. Every step is started from SPI transfer
+// complete callback, so CPU never waits for SPI and LVGL can render next
+// strip meanwhile.
+//
+
+enum {
+    STEP_VSCRDEF,
+    STEP_VSCRDEF_DATA,
+    STEP_VSCRSADD,
+    STEP_VSCRSADD_DATA,
+    STEP_SEGMENT,
+    STEP_CASET,
+    STEP_CASET_DATA,
+    STEP_RASET,
+    STEP_RASET_DATA,
+    STEP_RAMWR,
+    STEP_PIXELS,
+    STEP_DONE
+};
+
+static volatile uint8_t flush_step;
+
+// Hardware scroll state. Changed between flushes, and sent to display
+// before the next one.
+static DisplayScroll scroll;
+static bool scroll_changed = false;
+
+static struct {
+    uint8_t vscrdef[6];
+    uint8_t vscrsadd[2];
+    uint8_t caset[4];
+    uint8_t raset[4];
+    uint16_t * pixels;
+    uint16_t count;
+    // Flushed area is sent by segments with continuous memory rows
+    DisplayScroll map;
+    int16_t y;
+    int16_t y2;
+    int16_t width;
+} flush;
+
+// Last window, to skip CASET/RASET if the same. Each flush fills the whole
+// window, so only RAMWR is needed to restart from its beginning.
+static lv_area_t last_window;
+static bool last_window_valid = false;
+
+// SPI data size can be changed only while SPI is disabled. DMA is used for
+// pixels only, and is configured for halfwords once, at init.
+static void ST7735_SetFrame16(bool on)
+{
+    __HAL_SPI_DISABLE(hspi);
+    hspi->Init.DataSize = on ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT;
+    MODIFY_REG(hspi->Instance->CR2, SPI_CR2_DS, hspi->Init.DataSize);
+}
+
+static void ST7735_FlushStep();
+
+// Prepare window of the next segment and start sending it
+static void ST7735_FlushSegment()
+{
+    int16_t rows = flush.map.run(flush.y, flush.y2);
+    lv_area_t window;
+
+    window.x1 = flush.caset[1];
+    window.x2 = flush.caset[3];
+    window.y1 = flush.map.map(flush.y) + YSTART;
+    window.y2 = window.y1 + rows - 1;
+
+    flush.count = flush.width * rows;
+    flush.y += rows;
+
+    if (last_window_valid &&
+        window.x1 == last_window.x1 && window.y1 == last_window.y1 &&
+        window.x2 == last_window.x2 && window.y2 == last_window.y2)
+    {
+        ST7735_stats.window_skips++;
+        flush_step = STEP_RAMWR;
+        ST7735_FlushStep();
+        return;
+    }
+
+    last_window = window;
+    last_window_valid = true;
+
+    flush.raset[1] = (uint8_t)window.y1;
+    flush.raset[3] = (uint8_t)window.y2;
+
+    flush_step = STEP_CASET;
+    ST7735_FlushStep();
+}
+
+static void ST7735_FlushStep()
+{
+    static uint8_t cmd;
+
+    switch (flush_step++)
+    {
+    case STEP_VSCRDEF:
+        cmd = CMD_VSCRDEF;
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_RESET);
+        HAL_SPI_Transmit_IT(hspi, &cmd, 1);
+        break;
+
+    case STEP_VSCRDEF_DATA:
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
+        HAL_SPI_Transmit_IT(hspi, flush.vscrdef, sizeof(flush.vscrdef));
+        break;
+
+    case STEP_VSCRSADD:
+        cmd = CMD_VSCRSADD;
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_RESET);
+        HAL_SPI_Transmit_IT(hspi, &cmd, 1);
+        break;
+
+    case STEP_VSCRSADD_DATA:
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
+        HAL_SPI_Transmit_IT(hspi, flush.vscrsadd, sizeof(flush.vscrsadd));
+        break;
+
+    case STEP_SEGMENT:
+        ST7735_FlushSegment();
+        break;
+
+    case STEP_CASET:
+        cmd = CMD_CASET;
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_RESET);
+        HAL_SPI_Transmit_IT(hspi, &cmd, 1);
+        break;
+
+    case STEP_CASET_DATA:
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
+        HAL_SPI_Transmit_IT(hspi, flush.caset, sizeof(flush.caset));
+        break;
+
+    case STEP_RASET:
+        cmd = CMD_RASET;
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_RESET);
+        HAL_SPI_Transmit_IT(hspi, &cmd, 1);
+        break;
+
+    case STEP_RASET_DATA:
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
+        HAL_SPI_Transmit_IT(hspi, flush.raset, sizeof(flush.raset));
+        break;
+
+    case STEP_RAMWR:
+        cmd = CMD_RAMWR;
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_RESET);
+        HAL_SPI_Transmit_IT(hspi, &cmd, 1);
+        break;
+
+    case STEP_PIXELS:
+        ST7735_SetFrame16(true);
+        HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
+        HAL_SPI_Transmit_DMA(hspi, (uint8_t *)flush.pixels, flush.count);
+        break;
+
+    case STEP_DONE:
+        ST7735_SetFrame16(false);
+
+        if (flush.y <= flush.y2)
+        {
+            flush.pixels += flush.count;
+            ST7735_FlushSegment();
+            break;
+        }
+
+        display_stats_flush_end();
+        lv_disp_flush_ready(disp_drv);
+        break;
+    }
+}
+
+// Fill scroll commands params. Scroll area is set in physical frame memory
+// rows, and those go in reverse order to RASET rows, because of MADCTL_MY.
+// Disabled scroll is the full area without shift.
+static void ST7735_ScrollParams()
 {
-    int area_size = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+    uint16_t tfa = 0;
+    uint16_t vsa = GRAM_HEIGHT;
+    uint16_t ssa = 0;
 
-    ST7735_SetAddressWindow(area->x1, area->y1, area->x2, area->y2);
-    HAL_GPIO_WritePin(RS_Port, RS_Pin, GPIO_PIN_SET);
-    HAL_SPI_Transmit_DMA(hspi, (uint8_t*)color_p, area_size * sizeof(uint16_t));
+    if (scroll.enabled())
+    {
+        vsa = scroll.height;
+        tfa = GRAM_HEIGHT - (YSTART + scroll.top + scroll.height);
+        ssa = tfa + (scroll.height - scroll.offset) % scroll.height;
+    }
+
+    uint16_t bfa = GRAM_HEIGHT - tfa - vsa;
+
+    flush.vscrdef[0] = tfa >> 8;
+    flush.vscrdef[1] = tfa & 0xFF;
+    flush.vscrdef[2] = vsa >> 8;
+    flush.vscrdef[3] = vsa & 0xFF;
+    flush.vscrdef[4] = bfa >> 8;
+    flush.vscrdef[5] = bfa & 0xFF;
+    flush.vscrsadd[0] = ssa >> 8;
+    flush.vscrsadd[1] = ssa & 0xFF;
+}
+
+// Set band of full-width rows for hardware scroll, and reset shift. Zero
+// height disables scroll. Caller should redraw band.
+void ST7735_SetScrollArea(int16_t top, int16_t height)
+{
+    scroll.set_area(top, height);
+    scroll_changed = true;
 }
 
-// DMA SPI transfer of lvgl buffer data to ST7735 dispay complete,
-// inform lvgl about this
-void HAL_SPI_TxCpltCallback (SPI_HandleTypeDef *hspi)
+// Shift content of scroll area by `dy` rows, without redraw. Applied with
+// the next flush, which should draw exposed rows.
+void ST7735_Scroll(int16_t dy)
 {
-    lv_disp_flush_ready(disp_drv);
+    scroll.scroll(dy);
+    scroll_changed = true;
 }
 
+// Turn panel off & enter sleep mode, or back. Frame memory is kept. Uses
+// blocking transfers, so waits for flush in progress. Caller must pause
+// LVGL refresh before sleep.
+void ST7735_SetSleep(bool on)
+{
+    // SLPOUT is allowed 120 ms after SLPIN only
+    static uint32_t slpin_at = 0;
+
+    while (disp_drv->buffer->flushing) {}
+
+    if (on)
+    {
+        ST7735_WriteCommand(CMD_DISPOFF);
+        ST7735_WriteCommand(CMD_SLPIN);
+        slpin_at = HAL_GetTick();
+        return;
+    }
+
+    while (HAL_GetTick() - slpin_at < 120) {}
+
+    ST7735_WriteCommand(CMD_SLPOUT);
+    // Supply & clock stabilization, 5 ms by datasheet
+    HAL_Delay(5);
+    ST7735_WriteCommand(CMD_DISPON);
+}
+
+// Flush lvgl buffer to display memory. Returns immediately, transfer is
+// finished in background.
+void ST7735_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    (void)disp_drv;
+
+    display_stats_flush_start(area);
+
+    flush.pixels = (uint16_t *)color_p;
+    flush.map = scroll;
+    flush.y = area->y1;
+    flush.y2 = area->y2;
+    flush.width = area->x2 - area->x1 + 1;
+    flush.caset[1] = (uint8_t)(area->x1 + XSTART);
+    flush.caset[3] = (uint8_t)(area->x2 + XSTART);
+
+    if (scroll_changed)
+    {
+        scroll_changed = false;
+        ST7735_ScrollParams();
+        flush_step = STEP_VSCRDEF;
+        ST7735_FlushStep();
+        return;
+    }
+
+    ST7735_FlushSegment();
+}
+
+// SPI transfer of current pipeline step complete => go to next one
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *p_hspi)
+{
+    if (p_hspi != hspi) return;
+
+    ST7735_FlushStep();
+}
@@ -3,7 +3,18 @@
 
 #include "lvgl.h"
 
+// Driver specific counters, reset by reader. Common ones are in
+// `display_stats.h`.
+typedef struct {
+    uint32_t window_skips;  // flushes with unchanged window, CASET/RASET skipped
+} ST7735_Stats;
+
+extern ST7735_Stats ST7735_stats;
+
 void ST7735_Init(SPI_HandleTypeDef *p_hspi, lv_disp_drv_t *p_disp_drv);
+void ST7735_SetScrollArea(int16_t top, int16_t height);
+void ST7735_Scroll(int16_t dy);
+void ST7735_SetSleep(bool on);
 void ST7735_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
 
 #endif // __ST7735_H__
@@ -32,6 +32,7 @@
 
 extern TIM_HandleTypeDef htim6;
 extern TIM_HandleTypeDef htim7;
+extern TIM_HandleTypeDef htim17;
 
 /* USER CODE BEGIN Private defines */
 
@@ -39,6 +40,10 @@ extern TIM_HandleTypeDef htim7;
 
 void MX_TIM6_Init(void);
 void MX_TIM7_Init(void);
+void MX_TIM17_Init(void);
+
+void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
+                    
 
 /* USER CODE BEGIN Prototypes */
 
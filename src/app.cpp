@@ -3,79 +3,126 @@
 #include "screen_dose.h"
 #include "screen_flow.h"
 #include "screen_settings.h"
-#include"doses.h"
 #include "lvgl.h"
-#include "etl/cyclic_value.h"
 
 #include "eeprom_emu.h"
-#include "eeprom_flash_driver.h"
+#include "settings.h"
+#include "doses.h"
 #include "stepper_control.h"
 
 //#include <stdio.h>
 #include "fonts_custom.h"
+#include "glyph_cache.h"
+#include "refresh_governor.h"
+#include "display_sleep.h"
+#include "input_stats.h"
 
-EepromEmu<EepromFlashDriver> eeprom;
+EepromEmu<hal::EepromDriver> eeprom;
 app_data_t app_data;
 
 StepperPwmParams pwm_params;
 StepperControl<hal::StepperIO> stepper_control(&pwm_params);
 
-// eeprom map
-enum {
-    ADDR_NEEDLE_DIA = 0,
-    ADDR_SYRINGE_DIA = 1,
-    ADDR_VISCOSITY = 2,
-    ADDR_FLUX_PERCENT = 3,
-    ADDR_DOSE_VOLUME = 4,
-    ADDR_SPEED_SCALE = 5,
-    ADDR_FLOW_MODE = 6,
-    ADDR_LCD_BRIGHTNESS = 7
-};
+// eeprom map. Not constexpr, default dose comes from `doses[]`.
+static const auto settings_schema = std::make_tuple(
+    //      addr  variable                  default           min               max
+    SETTING(0,    app_data.needle_dia,      0.5f,             NEEDLE_DIA_MIN,   NEEDLE_DIA_MAX),
+    SETTING(1,    app_data.syringe_dia,     15.0f,            SYRINGE_DIA_MIN,  SYRINGE_DIA_MAX),
+    SETTING(2,    app_data.viscosity,       1.0f,             VISCOSITY_MIN,    VISCOSITY_MAX),
+    SETTING(3,    app_data.flux_percent,    10.0f,            FLUX_PERCENT_MIN, FLUX_PERCENT_MAX),
+    SETTING(4,    app_data.dose_volume,     doses[0].volume,  0.0f,             DOSE_VOLUME_MAX),
+    SETTING(5,    app_data.speed_scale,     1.0f,             SPEED_SCALE_MIN,  SPEED_SCALE_MAX),
+    SETTING(6,    app_data.flow_mode,       false,            false,            true),
+    SETTING(7,    app_data.lcd_brightness,  LCD_BRIGHTNESS_MAX, 0,              LCD_BRIGHTNESS_MAX)
+);
+
+static SettingsStore<
+    EepromEmu<hal::EepromDriver>,
+    decltype(settings_schema)
+> settings(eeprom, settings_schema);
+
+
+static void update_eeprom_stats()
+{
+    auto & s = eeprom.get_stats();
+    eeprom_stats_t & d = app_data.eeprom_stats;
 
+    d.generation = s.generation;
+    d.erases = s.erases;
+    d.user_bytes = s.user_bytes;
+    d.compaction_bytes = s.compaction_bytes;
+}
 
 static void load_settings()
 {
-    app_data.needle_dia     = eeprom.read_float(ADDR_NEEDLE_DIA, 0.5f);
-    app_data.syringe_dia    = eeprom.read_float(ADDR_SYRINGE_DIA, 15.0f);
-    app_data.viscosity      = eeprom.read_float(ADDR_VISCOSITY, 1.0);
-    app_data.flux_percent   = eeprom.read_float(ADDR_FLUX_PERCENT, 10.0f);
-    app_data.dose_volume    = eeprom.read_float(ADDR_DOSE_VOLUME, doses[0].volume);
-    app_data.speed_scale    = eeprom.read_float(ADDR_SPEED_SCALE, 1.0f);
-    app_data.flow_mode      = (bool)eeprom.read_u32(ADDR_FLOW_MODE, 0);
-    app_data.lcd_brightness = (uint8_t)eeprom.read_u32(ADDR_LCD_BRIGHTNESS, 100);
+    settings.load();
+    update_eeprom_stats();
 }
 
-static void save_settings()
+// Write changed values only, all at once, to not get mixed config on
+// power loss
+static bool save_settings()
 {
-    eeprom.write_float(ADDR_NEEDLE_DIA, app_data.needle_dia);
-    eeprom.write_float(ADDR_SYRINGE_DIA, app_data.syringe_dia);
-    eeprom.write_float(ADDR_VISCOSITY,app_data.viscosity);
-    eeprom.write_float(ADDR_FLUX_PERCENT, app_data.flux_percent);
-    eeprom.write_float(ADDR_DOSE_VOLUME, app_data.dose_volume);
-    eeprom.write_float(ADDR_SPEED_SCALE, app_data.speed_scale);
-    eeprom.write_u32(ADDR_FLOW_MODE, (uint32_t)app_data.flow_mode);
-    eeprom.write_u32(ADDR_LCD_BRIGHTNESS, app_data.lcd_brightness);
+    bool ok = settings.save();
+    update_eeprom_stats();
+    return ok;
 }
 
 
+// Settings write-behind. Flash program & erase stall CPU and disturb step
+// timing. So, while motor runs, writes are postponed to idle window, but
+// not longer than deadline after the first unsaved change.
+#define SAVER_DELAY_MS 1000
+#define SAVER_RETRY_MS 50
+#define SAVER_DEADLINE_MS 10000
+
 static bool saver_has_data = false;
+static uint32_t saver_first_change;
 
 static void saver_task(lv_task_t * task)
 {
+    saver_stats_t & stats = app_data.saver_stats;
+
     if (!saver_has_data) return;
-    saver_has_data = false;
-    save_settings();
 
-    (void)task;
+    if (!stepper_control.is_idle())
+    {
+        if (lv_tick_elaps(saver_first_change) < SAVER_DEADLINE_MS)
+        {
+            // Poll more often, to catch short pauses between doses
+            stats.deferrals++;
+            lv_task_set_period(task, SAVER_RETRY_MS);
+            return;
+        }
+
+        stats.deadline_flushes++;
+    }
+
+    lv_task_set_period(task, SAVER_DELAY_MS);
+
+    // Keep data on failure, to retry on next run
+    if (!save_settings())
+    {
+        stats.queue_depth = settings.pending();
+        return;
+    }
+
+    saver_has_data = false;
+    stats.flushes++;
+    stats.queue_depth = 0;
 }
 
 // Save config to eeprom, but wait 1s of inactivity first
 static void save_settings_debounced()
 {
-    static lv_task_t * task = lv_task_create(saver_task, 1000, LV_TASK_PRIO_LOWEST, NULL);
+    static lv_task_t * task = lv_task_create(saver_task, SAVER_DELAY_MS, LV_TASK_PRIO_LOWEST, NULL);
 
+    if (!saver_has_data) saver_first_change = lv_tick_get();
+
+    lv_task_set_period(task, SAVER_DELAY_MS);
     lv_task_reset(task); // Start counting timeout from zero
     saver_has_data = true;
+    app_data.saver_stats.queue_depth = settings.pending();
 }
 
 // Called after any settings update. Recalculate motor params and store
@@ -88,13 +135,20 @@ void app_update_settings()
 
 static void (*prev_screen_destroy)() = NULL;
 
-void app_screen_create(bool to_settings)
+void app_screen_destroy()
 {
     if (prev_screen_destroy) (*prev_screen_destroy)();
+    prev_screen_destroy = NULL;
+}
+
+void app_screen_create(bool to_settings)
+{
+    app_screen_destroy();
 
     if (to_settings)
     {
         prev_screen_destroy = &screen_settings_destroy;
+        input_stats_set_screen(INPUT_SCREEN_SETTINGS);
         screen_settings_create();
         return;
     }
@@ -102,10 +156,12 @@ void app_screen_create(bool to_settings)
     if (app_data.flow_mode)
     {
         prev_screen_destroy = &screen_flow_destroy;
+        input_stats_set_screen(INPUT_SCREEN_FLOW);
         screen_flow_create();
     }
     else {
         prev_screen_destroy = &screen_dose_destroy;
+        input_stats_set_screen(INPUT_SCREEN_DOSE);
         screen_dose_create();
     }
 }
@@ -165,30 +221,33 @@ static void create_styles()
 }
 
 
-static void dispence_btn_scan_task(lv_task_t * task)
+// Called by HAL on start key change, at once (on device - from interrupt).
+// Motor gets command without waiting for main loop.
+static void dispence_btn_handler(bool pressed)
 {
-    static bool prev_pressed = false;
-    static bool prev_press_mode_flow = false;
+    static bool press_mode_flow = false;
 
-    if (!prev_pressed)
+    if (pressed)
     {
-        if (hal::key_start_on())
-        {
-            prev_pressed = true;
-            prev_press_mode_flow = app_data.flow_mode;
+        press_mode_flow = app_data.flow_mode;
 
-            if (app_data.flow_mode) stepper_control.flow();
-            else stepper_control.dose();
-        }
+        if (app_data.flow_mode) stepper_control.flow();
+        else stepper_control.dose();
     }
     else
     {
-        if (!hal::key_start_on())
-        {
-            prev_pressed = false;
-            if (prev_press_mode_flow) stepper_control.stop();
-        }
+        if (press_mode_flow) stepper_control.stop();
     }
+}
+
+static void dispence_btn_scan_task(lv_task_t * task)
+{
+    bool busy = !stepper_control.is_idle();
+
+    // Throttle display while motor runs
+    refresh_governor_set_busy(busy);
+
+    if (hal::key_start_on() || busy) display_sleep_activity();
 
     (void)task;
 }
@@ -197,20 +256,24 @@ static void dispence_btn_scan_task(lv_task_t * task)
 static void hires_tick_handler()
 {
     stepper_control.tick();
-
-    static etl::cyclic_value<uint8_t, 0, 99> brightness_count;
-
-    if (++brightness_count < app_data.lcd_brightness) hal::backlight(true);
-    else hal::backlight(false);
 }
 
 
-int main()
+// Everything except main loop. Tests with headless HAL run it instead of
+// `main()` and drive the loop themselves.
+void app_init()
 {
     lv_init();
     hal::setup();
-    hal::backlight(true);
     load_settings();
+    display_sleep_init(app_data.kbd);
+    display_sleep_set_brightness(app_data.lcd_brightness);
+
+    // Effective only with GLYPH_CACHE_SIZE set, for fonts built with compression
+    glyph_cache_attach(&my_font_roboto_12);
+    glyph_cache_attach(&my_font_roboto_14);
+    glyph_cache_attach(&my_font_roboto_num_18);
+    glyph_cache_attach(&my_font_icons_18);
 
     create_styles();
     lv_obj_set_style(lv_scr_act(), &app_data.styles.main);
@@ -228,7 +291,17 @@ int main()
     app_screen_create(false);
 
     hal::set_hires_timer_cb(hires_tick_handler);
+    hal::set_key_start_cb(dispence_btn_handler);
     lv_task_create(dispence_btn_scan_task, 30, LV_TASK_PRIO_HIGH, NULL);
+}
 
+
+#ifndef UNIT_TEST
+
+int main()
+{
+    app_init();
     hal::loop();
 }
+
+#endif
@@ -15,8 +15,37 @@
 #define COLOR_SECONDARY lv_color_mix(LV_COLOR_MAKE(0x54, 0x6B, 0xE5), LV_COLOR_WHITE, LV_OPA_80)
 #define COLOR_BG_HIGHLIGHT LV_COLOR_MAKE(0x33, 0x33, 0x33)
 
-// For hal driver
-#define HACK_EVENT_RELEASED 0xFE
+// Value ranges. Shared by UI and settings load, so load never clamps values
+// user could set.
+#define NEEDLE_DIA_MIN 0.3f
+#define NEEDLE_DIA_MAX 2.0f
+#define SYRINGE_DIA_MIN 4.0f
+#define SYRINGE_DIA_MAX 30.0f
+#define VISCOSITY_MIN 1.0f
+#define VISCOSITY_MAX 1000.0f
+#define FLUX_PERCENT_MIN 1.0f
+#define FLUX_PERCENT_MAX 50.0f
+#define SPEED_SCALE_MIN 0.1f
+#define SPEED_SCALE_MAX 9.9f
+#define LCD_BRIGHTNESS_MAX 100
+
+// Release of non-ENTER key, sent by keypad driver to focused object
+#define APP_EVENT_KEY_RELEASED 0xFE
+
+typedef struct {
+    uint8_t queue_depth;        // changed settings, not written yet
+    uint32_t deferrals;         // save attempts, postponed while motor runs
+    uint32_t deadline_flushes;  // saves forced by deadline while motor runs
+    uint32_t flushes;
+} saver_stats_t;
+
+// Copy of eeprom wear telemetry, updated after load/save
+typedef struct {
+    uint32_t generation;        // bank moves since format
+    uint32_t erases;            // since boot
+    uint32_t user_bytes;        // since boot
+    uint32_t compaction_bytes;  // since boot
+} eeprom_stats_t;
 
 typedef struct {
     // Physics
@@ -51,13 +80,18 @@ typedef struct {
     lv_indev_t * kbd;
     lv_group_t * group;
 
+    saver_stats_t saver_stats;
+    eeprom_stats_t eeprom_stats;
+
 } app_data_t;
 
 
 extern app_data_t app_data;
+void app_init();
 void app_update_settings();
 void app_mode_switch();
 void app_screen_create(bool to_settings);
+void app_screen_destroy();
 
 #ifdef __cplusplus
   }
@@ -0,0 +1,40 @@
+#include "backlight.h"
+#include "app_hal.h"
+#include "lvgl.h"
+
+// Current brightness level, animated by fades
+static int16_t level = 0;
+
+
+static void apply(int16_t value)
+{
+    level = value;
+    hal::backlight(backlight_gamma((uint16_t)level));
+}
+
+static void fade_anim_cb(void * var, lv_anim_value_t value)
+{
+    (void)var;
+    apply(value);
+}
+
+
+void backlight_set(uint8_t percent, uint32_t fade_ms)
+{
+    int16_t target = (int16_t)(LV_MATH_MIN(percent, 100) << 8);
+
+    lv_anim_del(&level, fade_anim_cb);
+
+    if (!fade_ms || target == level)
+    {
+        apply(target);
+        return;
+    }
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, &level, fade_anim_cb);
+    lv_anim_set_values(&a, level, target);
+    lv_anim_set_time(&a, (uint16_t)fade_ms, 0);
+    lv_anim_create(&a);
+}
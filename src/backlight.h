@@ -0,0 +1,43 @@
+#ifndef __BACKLIGHT__
+#define __BACKLIGHT__
+
+// LCD backlight brightness, with gamma correction & fades.
+//
+// Brightness is perceptual, in percents, as in settings. It's converted to
+// linear PWM duty for `hal::backlight()`. Fades interpolate brightness, not
+// duty, so steps look uniform.
+
+#include <stdint.h>
+
+#ifndef BACKLIGHT_FADE_MS
+#define BACKLIGHT_FADE_MS 300
+#endif
+
+// `hal::backlight()` duty for full on
+#define BACKLIGHT_DUTY_MAX 0xFFFF
+
+// Brightness in 1/256 of percent
+#define BACKLIGHT_LEVEL_MAX (100 << 8)
+
+// Linear PWM duty for brightness level, gamma 2.2. Table with 5% steps,
+// interpolated between.
+inline uint16_t backlight_gamma(uint16_t level)
+{
+    static const uint16_t table[21] = {
+        0, 90, 413, 1009, 1900, 3104, 4636, 6508, 8730, 11312, 14263,
+        17590, 21301, 25403, 29901, 34802, 40112, 45835, 51976, 58542, 65535
+    };
+    const uint16_t step = BACKLIGHT_LEVEL_MAX / 20;
+
+    if (level >= BACKLIGHT_LEVEL_MAX) return BACKLIGHT_DUTY_MAX;
+
+    uint16_t idx = level / step;
+    uint32_t frac = level % step;
+
+    return (uint16_t)(table[idx] + (table[idx + 1] - table[idx]) * frac / step);
+}
+
+// Fade to brightness (0..100%). Zero time applies at once.
+void backlight_set(uint8_t percent, uint32_t fade_ms = BACKLIGHT_FADE_MS);
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef __DISPLAY_SCROLL__
+#define __DISPLAY_SCROLL__
+
+// Row mapping for display hardware vertical scroll.
+//
+// Scroll area is a band of full-width screen rows [top, top + height).
+// Controller shows frame memory of this band cyclically shifted, so content
+// can be moved without resend. Only rows exposed by shift have to be drawn.
+//
+// Screen row `y` inside band is stored in frame memory row
+// `top + (y - top + offset) % height`, rows outside band are not remapped.
+// Display drivers use `map()` & `run()` to split flushed area into windows
+// with continuous memory rows.
+
+#include <stdint.h>
+
+class DisplayScroll
+{
+public:
+    int16_t top = 0;
+    int16_t height = 0;
+    // Memory row of the band top line, relative to `top`
+    int16_t offset = 0;
+
+    // Set band & reset shift. Zero height disables remap.
+    void set_area(int16_t area_top, int16_t area_height)
+    {
+        top = area_top;
+        height = area_height;
+        offset = 0;
+    }
+
+    bool enabled() const { return height > 0; }
+
+    // Shift band content down by `dy` rows (up if negative). Rows exposed at
+    // the top (bottom) of band keep old data and must be redrawn.
+    void scroll(int16_t dy)
+    {
+        if (!enabled()) return;
+
+        offset = (int16_t)((offset - dy) % height);
+        if (offset < 0) offset += height;
+    }
+
+    // Frame memory row for screen row
+    int16_t map(int16_t y) const
+    {
+        if (!enabled() || y < top || y >= top + height) return y;
+
+        int16_t row = (int16_t)(y - top + offset);
+        if (row >= height) row -= height;
+
+        return (int16_t)(top + row);
+    }
+
+    // Number of rows, starting from `y` (up to `y2` inclusive), stored in
+    // continuous frame memory rows. Flush is split by these runs.
+    int16_t run(int16_t y, int16_t y2) const
+    {
+        int16_t end = (int16_t)(y2 + 1);
+
+        if (enabled())
+        {
+            if (y < top) {
+                if (end > top) end = top;
+            }
+            else if (y < top + height)
+            {
+                // Up to band end or memory wrap, whichever first
+                int16_t wrap = (int16_t)(y + height - (map(y) - top));
+                if (end > wrap) end = wrap;
+                if (end > top + height) end = (int16_t)(top + height);
+            }
+        }
+
+        return (int16_t)(end - y);
+    }
+};
+
+#endif
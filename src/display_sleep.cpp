@@ -0,0 +1,106 @@
+#include "display_sleep.h"
+#include "backlight.h"
+#include "app_hal.h"
+
+enum {
+    STATE_ON,
+    STATE_DIM,
+    STATE_SLEEP
+};
+
+static uint8_t state = STATE_ON;
+static uint8_t brightness = 100;
+static lv_task_prio_t refr_prio;
+
+static bool (*kbd_read_orig)(lv_indev_drv_t * drv, lv_indev_data_t * data) = NULL;
+// Key, which woke display, until released
+static bool swallow = false;
+
+
+static void wake()
+{
+    if (state == STATE_SLEEP)
+    {
+        lv_task_t * refr_task = lv_disp_get_default()->refr_task;
+
+        hal::display_power(true);
+        lv_task_set_prio(refr_task, refr_prio);
+        lv_task_ready(refr_task);
+    }
+
+    state = STATE_ON;
+    backlight_set(brightness, 0);
+}
+
+static void enter_sleep()
+{
+    lv_task_t * refr_task = lv_disp_get_default()->refr_task;
+
+    backlight_set(0, 0);
+
+    // Stop refresh first, so that panel is not written after sleep
+    refr_prio = (lv_task_prio_t)refr_task->prio;
+    lv_task_set_prio(refr_task, LV_TASK_PRIO_OFF);
+    hal::display_power(false);
+
+    state = STATE_SLEEP;
+}
+
+static bool kbd_read(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    bool more = kbd_read_orig(drv, data);
+
+    if (data->state == LV_INDEV_STATE_PR && state != STATE_ON)
+    {
+        if (state == STATE_SLEEP) swallow = true;
+        wake();
+    }
+
+    if (swallow)
+    {
+        if (data->state == LV_INDEV_STATE_REL) swallow = false;
+        data->state = LV_INDEV_STATE_REL;
+    }
+
+    return more;
+}
+
+static void check_task(lv_task_t * task)
+{
+    (void)task;
+
+    uint32_t inactive = lv_disp_get_inactive_time(NULL);
+
+    if (state == STATE_ON && inactive >= DISPLAY_DIM_DELAY)
+    {
+        state = STATE_DIM;
+        backlight_set(LV_MATH_MIN(brightness, DISPLAY_DIM_LEVEL), DISPLAY_DIM_FADE_MS);
+    }
+
+    if (state == STATE_DIM && inactive >= DISPLAY_SLEEP_DELAY) enter_sleep();
+}
+
+
+void display_sleep_init(lv_indev_t * kbd)
+{
+    kbd_read_orig = kbd->driver.read_cb;
+    kbd->driver.read_cb = kbd_read;
+
+    lv_task_create(check_task, 200, LV_TASK_PRIO_LOW, NULL);
+}
+
+
+void display_sleep_set_brightness(uint8_t percent)
+{
+    brightness = percent;
+
+    if (state == STATE_ON) backlight_set(brightness);
+}
+
+
+void display_sleep_activity()
+{
+    lv_disp_trig_activity(NULL);
+
+    if (state != STATE_ON) wake();
+}
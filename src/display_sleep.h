@@ -0,0 +1,44 @@
+#ifndef __DISPLAY_SLEEP__
+#define __DISPLAY_SLEEP__
+
+// Display power policy on inactivity.
+//
+// - No activity for DISPLAY_DIM_DELAY: backlight fades to DISPLAY_DIM_LEVEL.
+// - No activity for DISPLAY_SLEEP_DELAY: backlight off, panel off & in sleep
+//   mode, LVGL refresh paused. Frame memory is kept, changes made meanwhile
+//   are drawn on wake.
+//
+// Any key wakes display at once. Keypad press, which wakes display from
+// sleep, is swallowed - nobody sees what it would do. Start key is handled
+// by app directly and is not affected, dispense starts without delay.
+
+#include "lvgl.h"
+
+#ifndef DISPLAY_DIM_DELAY
+#define DISPLAY_DIM_DELAY (60 * 1000)
+#endif
+
+#ifndef DISPLAY_SLEEP_DELAY
+#define DISPLAY_SLEEP_DELAY (5 * 60 * 1000)
+#endif
+
+// Dimmed brightness, %. Used if less than configured one.
+#ifndef DISPLAY_DIM_LEVEL
+#define DISPLAY_DIM_LEVEL 10
+#endif
+
+#ifndef DISPLAY_DIM_FADE_MS
+#define DISPLAY_DIM_FADE_MS 1000
+#endif
+
+// Hook keypad input & start inactivity checks. Call after keypad registered.
+void display_sleep_init(lv_indev_t * kbd);
+
+// Brightness (0..100%) for active state. Applied with fade if active.
+void display_sleep_set_brightness(uint8_t percent);
+
+// Report activity, not visible to LVGL input (start key, motor run). Wakes
+// display if dimmed or sleeping.
+void display_sleep_activity();
+
+#endif
@@ -0,0 +1,117 @@
+#include "display_stats.h"
+#include "app_hal.h"
+#include "input_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static display_stats_t stats;
+static uint32_t period_start = 0;
+
+static uint32_t flush_started_at;
+// End of previous flush in current frame, 0 at frame start
+static uint32_t flush_ended_at = 0;
+
+
+void stats_hist_add(stats_hist_t * hist, uint32_t value)
+{
+    uint8_t bucket = 0;
+
+    while ((value >> (bucket + 1)) && bucket < STATS_HIST_BUCKETS - 1) bucket++;
+
+    hist->buckets[bucket]++;
+    hist->count++;
+    hist->sum += value;
+    if (value > hist->max) hist->max = value;
+}
+
+void display_stats_flush_start(const lv_area_t * area)
+{
+    uint32_t px = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+    flush_started_at = hal::micros();
+
+    if (flush_ended_at) stats_hist_add(&stats.render_us, flush_started_at - flush_ended_at);
+
+    stats_hist_add(&stats.flush_px, px);
+    stats.bytes += px * sizeof(lv_color_t);
+
+    input_stats_flush_start();
+}
+
+void display_stats_flush_end()
+{
+    flush_ended_at = hal::micros();
+    stats_hist_add(&stats.flush_us, flush_ended_at - flush_started_at);
+
+    input_stats_flush_end(flush_ended_at);
+}
+
+void display_stats_monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+    stats_hist_add(&stats.frame_ms, time);
+    flush_ended_at = 0;
+
+    input_stats_frame_end();
+
+    (void)drv;
+    (void)px;
+}
+
+void display_stats_handler(uint32_t time_us)
+{
+    stats_hist_add(&stats.handler_us, time_us);
+}
+
+
+void stats_hist_print(const char * name, const stats_hist_t * hist, const char * eol)
+{
+    if (!hist->count) return;
+
+    printf(
+        "  %s: n %d, avg %d, max %d |",
+        name,
+        (int)hist->count,
+        (int)(hist->sum / hist->count),
+        (int)hist->max
+    );
+
+    for (uint8_t i = 0; i < STATS_HIST_BUCKETS; i++)
+    {
+        if (!hist->buckets[i]) continue;
+
+        if (i < STATS_HIST_BUCKETS - 1) printf(" <%d:%d", 2 << i, (int)hist->buckets[i]);
+        else printf(" >=%d:%d", 1 << i, (int)hist->buckets[i]);
+    }
+
+    printf("%s", eol);
+}
+
+void display_stats_print(const char * eol)
+{
+    uint32_t now = hal::micros();
+    uint32_t period_us = now - period_start;
+
+    display_stats_t & s = stats;
+    uint32_t flush_us = s.flush_us.sum;
+
+    printf(
+        "[Display] fps: %d.%d, flushes: %d, %d bytes, %d bytes/ms%s",
+        (int)((uint64_t)s.frame_ms.count * 1000000 / period_us),
+        (int)((uint64_t)s.frame_ms.count * 10000000 / period_us % 10),
+        (int)s.flush_px.count,
+        (int)s.bytes,
+        flush_us ? (int)((uint64_t)s.bytes * 1000 / flush_us) : 0,
+        eol
+    );
+
+    stats_hist_print("frame ms", &s.frame_ms, eol);
+    stats_hist_print("flush px", &s.flush_px, eol);
+    stats_hist_print("flush us", &s.flush_us, eol);
+    stats_hist_print("render us", &s.render_us, eol);
+    stats_hist_print("task handler us", &s.handler_us, eol);
+
+    // Not atomic, but counters from interrupts can't break anything here
+    memset(&stats, 0, sizeof(stats));
+    period_start = now;
+}
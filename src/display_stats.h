@@ -0,0 +1,47 @@
+#ifndef __DISPLAY_STATS__
+#define __DISPLAY_STATS__
+
+// Display performance counters, to tune refresh period & buffer sizes with
+// real data. HAL display driver reports flushes and frames, main loop reports
+// `lv_task_handler()` time. Sysmon prints collected data and starts new
+// period.
+//
+// Histograms have log2 buckets: bucket N counts values in [2^N, 2^(N+1)),
+// first one counts values < 2, last one all big values.
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#define STATS_HIST_BUCKETS 14
+
+typedef struct {
+    uint32_t buckets[STATS_HIST_BUCKETS];
+    uint32_t count;
+    uint32_t sum;
+    uint32_t max;
+} stats_hist_t;
+
+typedef struct {
+    uint32_t bytes;
+    stats_hist_t flush_px;      // flushed area, pixels
+    stats_hist_t flush_us;      // flush time (DMA & commands), us
+    stats_hist_t render_us;     // time between flushes of a frame, us
+    stats_hist_t frame_ms;      // full refresh time, from LVGL monitor
+    stats_hist_t handler_us;    // lv_task_handler() time, us
+} display_stats_t;
+
+void stats_hist_add(stats_hist_t * hist, uint32_t value);
+// Print histogram line, if not empty
+void stats_hist_print(const char * name, const stats_hist_t * hist, const char * eol);
+
+// Called by display driver. `flush_end()` can be called from interrupt.
+void display_stats_flush_start(const lv_area_t * area);
+void display_stats_flush_end();
+void display_stats_monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+
+void display_stats_handler(uint32_t time_us);
+
+// Print summary & histograms, and reset counters
+void display_stats_print(const char * eol);
+
+#endif
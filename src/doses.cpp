@@ -1,4 +1,9 @@
 #include "doses.h"
+#include "app_hal.h"
+#include "eeprom_emu.h"
+
+#include <stdio.h>
+#include <string.h>
 
 #define DOSE_RECORD(VAL, DESC) { .volume = VAL, .desc = DESC, .title = #VAL" mm³" }
 
@@ -11,3 +16,70 @@ const dose_t doses[] = {
     DOSE_RECORD(0.700,  "chip 2512"),
     DOSE_RECORD(0, "") // Mark end of list
 };
+
+// Defined in app.cpp
+extern EepromEmu<hal::EepromDriver> eeprom;
+
+// Library entries use blobs from this id
+#define DOSE_BLOB_BASE 0
+#define DOSE_MAX_COUNT 32
+
+// Blob is [ volume (float) ] [ description, without trailing zero ].
+// Volume 0 marks end of list.
+
+static uint8_t builtin_count()
+{
+    uint8_t count = 0;
+    while (doses[count].volume != 0) count++;
+    return count;
+}
+
+// Format without float printf, to not pull it into firmware
+static void format_title(char * dst, float volume)
+{
+    uint32_t v = (uint32_t)(volume * 1000.0f + 0.5f);
+
+    snprintf(dst, DOSE_TITLE_MAX + 1, "%u.%03u mm³", (unsigned)(v / 1000), (unsigned)(v % 1000));
+}
+
+bool dose_load(uint8_t idx, dose_entry_t * entry)
+{
+    if (idx >= DOSE_MAX_COUNT) return false;
+
+    union { uint8_t b[4]; float f; } volume;
+    uint32_t desc_len = 0;
+
+    int32_t len = eeprom.read_blob(
+        DOSE_BLOB_BASE + idx,
+        [&](uint32_t ofs, const uint8_t * data, uint32_t size) {
+            for (uint32_t i = 0; i < size; i++)
+            {
+                uint32_t pos = ofs + i;
+
+                if (pos < 4) volume.b[pos] = data[i];
+                else if (pos - 4 < DOSE_DESC_MAX) entry->desc[desc_len++] = (char)data[i];
+            }
+        }
+    );
+
+    // Not stored => use built-in
+    if (len < 0)
+    {
+        if (idx >= builtin_count()) return false;
+
+        entry->volume = doses[idx].volume;
+        strncpy(entry->desc, doses[idx].desc, DOSE_DESC_MAX);
+        entry->desc[DOSE_DESC_MAX] = 0;
+        strncpy(entry->title, doses[idx].title, DOSE_TITLE_MAX);
+        entry->title[DOSE_TITLE_MAX] = 0;
+        return true;
+    }
+
+    // End of list mark or broken entry
+    if (len < 4 || !(volume.f > 0.0f && volume.f <= DOSE_VOLUME_MAX)) return false;
+
+    entry->volume = volume.f;
+    entry->desc[desc_len] = 0;
+    format_title(entry->title, volume.f);
+    return true;
+}
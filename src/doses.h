@@ -1,12 +1,35 @@
 #ifndef __DOSES__
 #define __DOSES__
 
+#include <stdint.h>
+
 typedef struct {
     const float volume;         // Volume to dispense, in mm³
     const char * const desc;    // Description
     const char * const title;   // Title (volume + " mm³", in text form)
 } dose_t;
 
+// Built-in defaults
 extern const dose_t doses[];
 
+//
+// Dose library. User entries are stored in eeprom blobs (one per entry), and
+// not stored ones are taken from built-in `doses[]`. Entries are loaded one
+// by one, without copying the whole library into RAM first.
+//
+
+// Upper limit of entry volume, mm³
+#define DOSE_VOLUME_MAX 100.0f
+
+#define DOSE_DESC_MAX 23
+#define DOSE_TITLE_MAX 19
+
+typedef struct {
+    float volume;
+    char desc[DOSE_DESC_MAX + 1];
+    char title[DOSE_TITLE_MAX + 1];
+} dose_entry_t;
+
+bool dose_load(uint8_t idx, dose_entry_t * entry);
+
 #endif
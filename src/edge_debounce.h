@@ -0,0 +1,53 @@
+#ifndef __EDGE_DEBOUNCE__
+#define __EDGE_DEBOUNCE__
+
+// Leading edge debouncer, for keys which need instant reaction.
+//
+// First edge after stable state is accepted at once, then pin is ignored for
+// `lockout` ticks, while contacts bounce. After lockout pin level is checked
+// again, to catch release (or press) that happened meanwhile.
+//
+// `edge()` is for pin change interrupt, `tick()` for periodic timer. Both
+// must be called from the same priority level. `tick()` alone also works, as
+// polling debouncer with 1 tick reaction.
+
+#include <stdint.h>
+
+class EdgeDebounce
+{
+    uint16_t lockout_ticks;
+    uint16_t lockout = 0;
+    bool state = false;
+
+    bool change(bool level)
+    {
+        if (level == state) return false;
+
+        state = level;
+        lockout = lockout_ticks;
+        return true;
+    }
+
+public:
+    EdgeDebounce(uint16_t lockout) : lockout_ticks(lockout) {}
+
+    // Pin changed to `level`. Returns true if state changed.
+    bool edge(bool level)
+    {
+        if (lockout) return false;
+
+        return change(level);
+    }
+
+    // Periodic call, with current pin level. Returns true if state changed.
+    bool tick(bool level)
+    {
+        if (lockout && --lockout) return false;
+
+        return change(level);
+    }
+
+    bool is_set() const { return state; }
+};
+
+#endif
@@ -8,13 +8,26 @@
 class FlashDriver {
 public:
     enum { BankSize = XXXX };
-    static void erase(uint8_t bank) {};
 
-    static uint32_t read(uint8_t bank, uint16_t addr);
+    // Program unit in bytes: 2 or 4. Only the matching write method is
+    // used, each flash location is programmed once between erases.
+    enum { ProgramSize = 2 };
 
-    // If 32bit write requires multiple operations, those MUST follow from
-    // least significant bits to most significant bits.
-    static uint32_t write(uint8_t bank, uint16_t addr, uint32_t data);
+    // 1 if flash is memory-mapped and `bank_ptr()` available. Then records
+    // are read directly, without `read_u16()` calls.
+    enum { MemoryMapped = 0 };
+    const uint8_t * bank_ptr(uint8_t bank);
+
+    // Called around every group of erase/write operations
+    void unlock();
+    void lock();
+
+    void erase(uint8_t bank);
+
+    uint16_t read_u16(uint8_t bank, uint32_t addr);
+
+    void write_u16(uint8_t bank, uint32_t addr, uint16_t data); // ProgramSize 2
+    void write_u32(uint8_t bank, uint32_t addr, uint32_t data); // ProgramSize 4
 }
 */
 
@@ -25,9 +38,16 @@ public:
 
     Bank Marker:
 
-    - [ 0x77EE, 0xFFFF,    0xFFFF, 0xFFFF ] => active, current
-    - [ 0x77EE, NOT_EMPTY, 0xFFFF, 0xFFFF ] => ready to erase (!active)
-    - [ 0xFFFF, 0xFFFF,    0xFFFF, 0xFFFF ] => erased OR on progress of transfer
+    - [ 0x77EE, generation, 0xFFFF,    0xFFFF    ] => active, current
+    - [ 0x77EE, generation, NOT_EMPTY, NOT_EMPTY ] => ready to erase (!active)
+    - [ 0xFFFF, 0xFFFF,     0xFFFF,    0xFFFF    ] => erased OR on progress of transfer
+
+    Generation is the number of bank moves since format, incremented on each
+    move. So every bank was erased about generation/2 times. 0xFFFF means
+    bank was created by old firmware, without generation (counted as 0).
+    Stored modulo 0xFFFF and compared with wrap. If power is lost between
+    new bank marker and dirty mark of old one, both banks are active, and
+    newer generation wins.
 
     Data record:
 
@@ -38,86 +58,375 @@ public:
     allow old data partial override with zero bits.
 
     Value 0x55AA at record start means write was completed with success
+
+    Record is programmed by driver units from the end to the start, so unit
+    with commit mark is always written last. 32-bit units halve program
+    operations per record (2 instead of 4), and halfword marks never share a
+    unit with data written earlier, so ECC flashes with 32-bit words work too.
+
+    64-bit units are not supported. Commit mark would need a separate record
+    then, and that doubles flash use for single writes - more programmed bytes
+    and more erases than with halfwords.
+
+    Note, flash programmed by halfwords internally (STM32F0) gets fewer driver
+    calls and unlocks with 32-bit units, but the same amount of programmed
+    data and the same wear.
+
+    Group (batch) records:
+
+    [ 0x5A5A, address_16, data_lo_16, data_hi_16 ] => group member, not visible
+    [ 0xA5NN, address_16, data_lo_16, data_hi_16 ] => group commit
+
+    Group members become visible only when followed by group commit record,
+    which covers NN preceding members. So group commit mark is the last thing
+    written, and the whole group appears at once. Members without commit (power
+    loss in the middle of batch) are ignored forever, even if new records
+    are appended after those.
+
+    Address 0xFFFF is reserved.
+
+    Counters:
+
+    [ 8 bytes bank marker ] [ records... ] [ tally 0 ] ... [ tally N-1 ]
+
+    For frequently incremented values (lifetime statistics). Counter value is
+    base + tally. Base is a regular record with address 0xFF00 + counter id.
+    Tally is an area of program units at the bank end, each increment zeroes
+    the next erased unit there. So most increments cost a single unit program
+    instead of 8-byte record. When tally is full, base record is written
+    instead. On bank move tally is folded into base, and starts from zero in
+    new bank.
+
+    Units are not reprogrammed, because many flashes (F0 too) allow single
+    write between erases. Torn unit is counted as used. Addresses
+    0xFF00..0xFF1F are reserved for counters.
+
+    Blobs:
+
+    Variable-length data, stored as 4-byte chunks in regular records. Chunk
+    address is 0x8000 + (blob_id << 8) + seq. Chunk 0 contains blob length,
+    next ones contain data, little-endian. The whole blob is written as single
+    group, with unchanged chunks skipped. Chunks beyond length are ignored.
+    Addresses 0x8000..0xBFFF are reserved for blobs.
+
+    When blob shrinks, its trailing chunks are deleted in the same group:
+
+    [ 0x5ADE, address_16, 0xXXXX, 0xXXXX ] => group member, deletes address
+
+    Deleted values read as not existing and are not copied on bank move.
+    Group commit is never a deletion.
+
+    New values are accepted only if all live data would fit into bank after
+    move, so the storage can always compact itself. Writes fail otherwise.
 */
 
-template <typename FLASH_DRIVER>
+template <typename FLASH_DRIVER, uint8_t COUNTERS = 0, uint32_t TALLY_SIZE = 256>
 class EepromEmu
 {
+public:
+    // Wear telemetry, see `get_stats()`. Byte counters are since boot.
+    struct Stats {
+        uint32_t generation = 0;        // bank moves since format
+        uint32_t erases = 0;
+        uint32_t user_bytes = 0;        // programmed for new values
+        uint32_t compaction_bytes = 0;  // programmed for copies & headers on bank move
+    };
+
+    // Batch item, see `write_batch()`
+    struct Item {
+        uint16_t addr;
+        uint32_t value;
+    };
+
+private:
     enum {
         EMPTY = 0xFFFF,
         RECORD_SIZE = 8,
+        PROGRAM_SIZE = FLASH_DRIVER::ProgramSize,
         BANK_HEADER_SIZE = 8,
+        // Where to write dirty marks, to not touch marker & generation
+        BANK_DIRTY_OFFSET = 4,
         COMMIT_MARK = 0x55AA,
+        GROUP_MARK = 0x5A5A,
+        GROUP_DELETE_MARK = 0x5ADE,
+        GROUP_COMMIT_MARK = 0xA500,
         BANK_MARK = 0x77EE,
-        BANK_DIRTY_MARK = 0x5555
+        BANK_DIRTY_MARK = 0x5555,
+        COUNTER_ADDR = 0xFF00,
+        BLOB_ADDR = 0x8000,
+        TALLY_UNITS = TALLY_SIZE / PROGRAM_SIZE,
+        TALLY_START = FLASH_DRIVER::BankSize - COUNTERS * TALLY_SIZE,
+        // Space for regular records
+        RECORDS_END = TALLY_START
     };
 
+    static_assert(PROGRAM_SIZE == 2 || PROGRAM_SIZE == 4, "Program unit should be 2 or 4 bytes");
+    static_assert(COUNTERS <= 32, "Too many counters");
+    static_assert(TALLY_SIZE % PROGRAM_SIZE == 0, "Tally size should be multiple of program unit");
+
     bool initialized = false;
+    Stats stats;
     uint8_t current_bank = 0;
     uint32_t next_write_offset;
 
+    template <int N> struct Mapped {};
+
+    // Data access. Memory-mapped flash is read via pointers, with word-wide
+    // loads. Offsets are always aligned.
+    uint16_t get_u16(uint8_t bank, uint32_t ofs, Mapped<1>)
+    {
+        return *(const uint16_t *)(flash.bank_ptr(bank) + ofs);
+    }
+
+    uint32_t get_u32(uint8_t bank, uint32_t ofs, Mapped<1>)
+    {
+        return *(const uint32_t *)(flash.bank_ptr(bank) + ofs);
+    }
+
+    uint16_t get_u16(uint8_t bank, uint32_t ofs, Mapped<0>)
+    {
+        return flash.read_u16(bank, ofs);
+    }
+
+    uint32_t get_u32(uint8_t bank, uint32_t ofs, Mapped<0>)
+    {
+        return flash.read_u16(bank, ofs) | ((uint32_t)flash.read_u16(bank, ofs + 2) << 16);
+    }
+
+    uint16_t get_u16(uint8_t bank, uint32_t ofs)
+    {
+        return get_u16(bank, ofs, Mapped<FLASH_DRIVER::MemoryMapped>());
+    }
+
+    uint32_t get_u32(uint8_t bank, uint32_t ofs)
+    {
+        return get_u32(bank, ofs, Mapped<FLASH_DRIVER::MemoryMapped>());
+    }
+
+    // Record is [ mark, addr, value_lo, value_hi ]
+    uint16_t get_mark(uint8_t bank, uint32_t ofs) { return get_u16(bank, ofs); }
+    uint16_t get_addr(uint8_t bank, uint32_t ofs) { return get_u16(bank, ofs + 2); }
+    uint32_t get_value(uint8_t bank, uint32_t ofs) { return get_u32(bank, ofs + 4); }
+
+    bool is_empty_record(uint8_t bank, uint32_t ofs)
+    {
+        return get_u32(bank, ofs) == UINT32_MAX && get_u32(bank, ofs + 4) == UINT32_MAX;
+    }
+
     bool is_clear(uint8_t bank)
     {
-        for (uint32_t i = 0; i < FLASH_DRIVER::BankSize; i += 2) {
-            if (flash.read_u16(bank, i) != EMPTY) return false;
+        for (uint32_t i = 0; i < FLASH_DRIVER::BankSize; i += 4) {
+            if (get_u32(bank, i) != UINT32_MAX) return false;
         }
         return true;
     }
 
+    // Generation is not checked, bank is active if not marked dirty
     bool is_active(uint8_t bank)
     {
-        if ((flash.read_u16(bank, 0) == BANK_MARK) &&
-            (flash.read_u16(bank, 2) == EMPTY) &&
-            (flash.read_u16(bank, 4) == EMPTY) &&
-            (flash.read_u16(bank, 6) == EMPTY)) return true;
+        if (get_u16(bank, 0) != BANK_MARK) return false;
 
-        return false;
+        for (uint32_t i = BANK_DIRTY_OFFSET; i < BANK_HEADER_SIZE; i += 2)
+        {
+            if (get_u16(bank, i) != EMPTY) return false;
+        }
+
+        return true;
+    }
+
+    uint32_t get_generation(uint8_t bank)
+    {
+        uint16_t gen = get_u16(bank, 2);
+        return gen == EMPTY ? 0 : gen;
+    }
+
+    bool is_newer(uint8_t bank, uint8_t other)
+    {
+        return (int16_t)(uint16_t)(get_generation(bank) - get_generation(other)) > 0;
     }
 
+    // Records are written one after another, without gaps. So the first
+    // empty slot can be found with binary search.
     uint32_t find_write_offset()
     {
-        uint32_t ofs = BANK_HEADER_SIZE;
+        uint32_t first = 0;
+        uint32_t last = (RECORDS_END - BANK_HEADER_SIZE) / RECORD_SIZE;
+
+        while (first < last)
+        {
+            uint32_t mid = (first + last) / 2;
+
+            if (is_empty_record(current_bank, BANK_HEADER_SIZE + mid * RECORD_SIZE)) last = mid;
+            else first = mid + 1;
+        }
+
+        return BANK_HEADER_SIZE + first * RECORD_SIZE;
+    }
+
+    bool is_empty_unit(uint8_t bank, uint32_t ofs)
+    {
+        for (uint32_t i = 0; i < PROGRAM_SIZE; i += 2)
+        {
+            if (get_u16(bank, ofs + i) != EMPTY) return false;
+        }
+        return true;
+    }
+
+    uint32_t tally_offset(uint8_t id) { return TALLY_START + id * TALLY_SIZE; }
 
-        for (; ofs <= FLASH_DRIVER::BankSize - RECORD_SIZE; ofs += RECORD_SIZE)
+    // Tally units are used one after another => binary search too
+    uint32_t tally_count(uint8_t bank, uint8_t id)
+    {
+        uint32_t first = 0;
+        uint32_t last = TALLY_UNITS;
+
+        while (first < last)
         {
-            if ((flash.read_u16(current_bank, ofs + 0) == EMPTY) &&
-                (flash.read_u16(current_bank, ofs + 2) == EMPTY) &&
-                (flash.read_u16(current_bank, ofs + 4) == EMPTY) &&
-                (flash.read_u16(current_bank, ofs + 6) == EMPTY)) break;
+            uint32_t mid = (first + last) / 2;
+
+            if (is_empty_unit(bank, tally_offset(id) + mid * PROGRAM_SIZE)) last = mid;
+            else first = mid + 1;
         }
 
-        return ofs;
+        return first;
     }
 
-    void move_bank(uint8_t from, uint8_t to, uint16_t ignore_addr=UINT16_MAX)
+    static uint16_t blob_addr(uint8_t id, uint8_t seq) { return BLOB_ADDR + (id << 8) + seq; }
+
+    bool is_counter(uint16_t addr)
     {
-        if (!is_clear(to)) flash.erase(to);
+        return addr >= COUNTER_ADDR && addr < COUNTER_ADDR + COUNTERS;
+    }
 
+    // Group commit without address is a torn unit, where mark was
+    // programmed before address.
+    bool is_group_commit(uint8_t bank, uint32_t ofs, uint16_t mark)
+    {
+        if ((mark & 0xFF00) != GROUP_COMMIT_MARK) return false;
+
+        return get_addr(bank, ofs) != EMPTY;
+    }
+
+    static bool is_group_member(uint16_t mark)
+    {
+        return mark == GROUP_MARK || mark == GROUP_DELETE_MARK;
+    }
+
+    // Check if record is valid. Standalone records have own commit mark,
+    // group members need lookup forward for group commit. Mark without
+    // address is a torn unit, the same as for group commit.
+    bool is_committed(uint8_t bank, uint32_t ofs, uint32_t end)
+    {
+        return is_committed(bank, ofs, end, get_mark(bank, ofs), get_addr(bank, ofs));
+    }
+
+    bool is_committed(uint8_t bank, uint32_t ofs, uint32_t end, uint16_t mark, uint16_t addr)
+    {
+        if (addr == EMPTY) return false;
+        if (mark == COMMIT_MARK) return true;
+        if (!is_group_member(mark)) return (mark & 0xFF00) == GROUP_COMMIT_MARK;
+
+        for (uint32_t i = ofs + RECORD_SIZE; i < end; i += RECORD_SIZE)
+        {
+            mark = get_mark(bank, i);
+
+            if (is_group_member(mark)) continue;
+            if (!is_group_commit(bank, i, mark)) return false;
+
+            // Make sure group commit covers this record. Leftovers of broken
+            // group can stay right before the new one.
+            return (i - ofs) / RECORD_SIZE <= (mark & 0xFFu);
+        }
+
+        return false;
+    }
+
+    template <int N> struct Unit {};
+
+    // Program single driver unit from halfwords list
+    void program(uint8_t bank, uint32_t ofs, const uint16_t * d, Unit<2>)
+    {
+        flash.write_u16(bank, ofs, d[0]);
+    }
+
+    void program(uint8_t bank, uint32_t ofs, const uint16_t * d, Unit<4>)
+    {
+        flash.write_u32(bank, ofs, d[0] | ((uint32_t)d[1] << 16));
+    }
+
+    void program(uint8_t bank, uint32_t ofs, const uint16_t * d)
+    {
+        program(bank, ofs, d, Unit<PROGRAM_SIZE>());
+    }
+
+    // Commit mark MUST be written last => program units from the end
+    void write_record(uint8_t bank, uint32_t ofs, uint16_t addr, uint32_t val, uint16_t mark)
+    {
+        const uint16_t data[4] = { mark, addr, (uint16_t)(val & 0xFFFF), (uint16_t)(val >> 16) };
+
+        for (uint32_t i = RECORD_SIZE; i > 0;)
+        {
+            i -= PROGRAM_SIZE;
+            program(bank, ofs + i, data + i / 2);
+        }
+    }
+
+    // Generation shares unit with marker, or is written before it
+    void write_bank_mark(uint8_t bank)
+    {
+        uint16_t gen = stats.generation % EMPTY;
+        const uint16_t data[4] = { BANK_MARK, gen, EMPTY, EMPTY };
+
+        if (PROGRAM_SIZE == 2) program(bank, 2, data + 1);
+        program(bank, 0, data);
+
+        stats.compaction_bytes += (PROGRAM_SIZE == 2) ? 4 : PROGRAM_SIZE;
+    }
+
+    void erase(uint8_t bank)
+    {
+        flash.erase(bank);
+        stats.erases++;
+    }
+
+    void write_bank_dirty_mark(uint8_t bank)
+    {
+        const uint16_t data[4] = { BANK_DIRTY_MARK, BANK_DIRTY_MARK, BANK_DIRTY_MARK, BANK_DIRTY_MARK };
+
+        for (uint32_t i = BANK_DIRTY_OFFSET; i < BANK_HEADER_SIZE; i += PROGRAM_SIZE)
+        {
+            program(bank, i, data);
+            stats.compaction_bytes += PROGRAM_SIZE;
+        }
+    }
+
+    // Walk latest committed values, as if copied to new bank. Items, selected
+    // by `mask`, replace stored values, ones in `del_mask` remove them.
+    // Records are written only if `write` set, else just counted - to check
+    // space before erase. Returns end offset, may be beyond bank end.
+    uint32_t move_records(uint8_t from, uint8_t to, const Item * items, uint8_t count,
+                          uint32_t mask, uint32_t del_mask, bool write)
+    {
         uint32_t dst_end_addr = BANK_HEADER_SIZE;
+        uint32_t counters_left = (COUNTERS < 32) ? (1UL << COUNTERS) - 1 : UINT32_MAX;
 
         for (uint32_t ofs = BANK_HEADER_SIZE; ofs < next_write_offset; ofs += RECORD_SIZE)
         {
             // Skip invalid records
-            if (flash.read_u16(from, ofs + 0) != COMMIT_MARK) continue;
-
-            uint16_t addr = flash.read_u16(from, ofs + 2);
-
-            // Skip variable with ignored address
-            if (addr == ignore_addr) continue;
+            if (!is_committed(from, ofs, next_write_offset)) continue;
 
-            uint16_t lo   = flash.read_u16(from, ofs + 4);
-            uint16_t hi   = flash.read_u16(from, ofs + 6);
+            uint16_t addr = get_addr(from, ofs);
 
             bool more_fresh_exists = false;
 
             // Check if more fresh record exists
             for (uint32_t i = ofs + RECORD_SIZE; i < next_write_offset; i += RECORD_SIZE)
             {
-                // Skip invalid records
-                if (flash.read_u16(from, i + 0) != COMMIT_MARK) continue;
-
                 // Skip different addresses
-                if (flash.read_u16(from, i + 2) != addr) continue;
+                if (get_addr(from, i) != addr) continue;
+
+                // Skip invalid records
+                if (!is_committed(from, i, next_write_offset)) continue;
 
                 // More fresh (=> already copied) found
                 more_fresh_exists = true;
@@ -126,40 +435,287 @@ class EepromEmu
 
             if (more_fresh_exists) continue;
 
-            flash.write_u16(to, dst_end_addr + 2, addr);
-            flash.write_u16(to, dst_end_addr + 4, lo);
-            flash.write_u16(to, dst_end_addr + 6, hi);
-            flash.write_u16(to, dst_end_addr + 0, COMMIT_MARK);
+            // Deleted value is not copied, new one (if any) goes with items
+            if (get_mark(from, ofs) == GROUP_DELETE_MARK) continue;
+
+            uint32_t val = get_value(from, ofs);
+            bool replaced = false;
+            bool deleted = false;
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                if ((mask & (1UL << i)) && items[i].addr == addr)
+                {
+                    val = items[i].value;
+                    mask &= ~(1UL << i);
+                    replaced = true;
+                    deleted = del_mask & (1UL << i);
+                }
+            }
+
+            if (deleted) continue;
+
+            // Fold tally into counter base
+            if (is_counter(addr))
+            {
+                if (write) val += tally_count(from, addr - COUNTER_ADDR);
+                counters_left &= ~(1UL << (addr - COUNTER_ADDR));
+            }
+
+            // New bank is not active until marker written, so group members
+            // can be stored as standalone records.
+            if (write)
+            {
+                write_record(to, dst_end_addr, addr, val, COMMIT_MARK);
+
+                if (replaced) stats.user_bytes += RECORD_SIZE;
+                else stats.compaction_bytes += RECORD_SIZE;
+            }
+
+            dst_end_addr += RECORD_SIZE;
+        }
+
+        // Add new variables
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (!(mask & (1UL << i)) || (del_mask & (1UL << i))) continue;
+
+            uint32_t val = items[i].value;
+
+            if (is_counter(items[i].addr))
+            {
+                if (write) val += tally_count(from, items[i].addr - COUNTER_ADDR);
+                counters_left &= ~(1UL << (items[i].addr - COUNTER_ADDR));
+            }
+
+            if (write)
+            {
+                write_record(to, dst_end_addr, items[i].addr, val, COMMIT_MARK);
+                stats.user_bytes += RECORD_SIZE;
+            }
+
+            dst_end_addr += RECORD_SIZE;
+        }
+
+        // Counters without base record yet. Space is counted for all of
+        // those, to never lose increments on the next moves.
+        for (uint8_t id = 0; id < COUNTERS; id++)
+        {
+            if (!(counters_left & (1UL << id))) continue;
+
+            if (write)
+            {
+                uint32_t val = tally_count(from, id);
+
+                if (!val) continue;
+
+                write_record(to, dst_end_addr, COUNTER_ADDR + id, val, COMMIT_MARK);
+                stats.compaction_bytes += RECORD_SIZE;
+            }
+
             dst_end_addr += RECORD_SIZE;
         }
 
+        return dst_end_addr;
+    }
+
+    // Copy actual values to other bank. Items, selected by `mask`, replace
+    // stored values. Those become visible together with new bank marker, so
+    // no data is lost on power failure in the middle. Returns false without
+    // any change if data does not fit.
+    bool move_bank(uint8_t from, uint8_t to, const Item * items, uint8_t count,
+                   uint32_t mask, uint32_t del_mask)
+    {
+        if (move_records(from, to, items, count, mask, del_mask, false) > RECORDS_END) return false;
+
+        if (!is_clear(to)) erase(to);
+
+        uint32_t dst_end_addr = move_records(from, to, items, count, mask, del_mask, true);
+
         // Mark new bank active
-        flash.write_u16(to, 0, BANK_MARK);
+        stats.generation++;
+        write_bank_mark(to);
 
         current_bank = to;
         next_write_offset = dst_end_addr;
 
         // Clean old bank in 2 steps to avoid UB: destroy header & run erase
-        flash.write_u16(from, 2, BANK_DIRTY_MARK);
-        flash.write_u16(from, 4, BANK_DIRTY_MARK);
-        flash.write_u16(from, 6, BANK_DIRTY_MARK);
-        flash.erase(from);
+        write_bank_dirty_mark(from);
+        erase(from);
+        return true;
+    }
+
+    // Write records for items, selected by `mask`. Multiple records are
+    // written as group, to become visible at once. Items in `del_mask` are
+    // written as deletions, those must not be the last in group. Returns
+    // false if no space even after bank move.
+    bool append(const Item * items, uint8_t count, uint32_t mask, uint32_t del_mask = 0)
+    {
+        uint8_t changed_count = 0;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (mask & (1UL << i)) changed_count++;
+        }
+
+        if (!changed_count) return true;
+
+        bool grouped = changed_count > 1;
+        uint32_t size = changed_count * RECORD_SIZE;
+
+        flash.unlock();
+
+        // Check free space and swap banks if needed. New values are written
+        // during move.
+        if (next_write_offset + size > RECORDS_END)
+        {
+            bool ok = move_bank(current_bank, current_bank ^ 1, items, count, mask, del_mask);
+            flash.lock();
+            return ok;
+        }
+
+        uint8_t left = changed_count;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (!(mask & (1UL << i))) continue;
+
+            left--;
+
+            uint16_t mark = grouped ? GROUP_MARK : COMMIT_MARK;
+
+            if (del_mask & (1UL << i)) mark = GROUP_DELETE_MARK;
+
+            // Last record commits group
+            if (!left && grouped) mark = GROUP_COMMIT_MARK + (changed_count - 1);
+
+            write_record(current_bank, next_write_offset, items[i].addr, items[i].value, mark);
+            next_write_offset += RECORD_SIZE;
+            stats.user_bytes += RECORD_SIZE;
+        }
+
+        flash.lock();
+        return true;
+    }
+
+    // Reverse scan for the latest values of items, selected by `pending` mask.
+    // Calls `fn(index, value)` for found ones, returns mask of not found.
+    // Deleted values are reported as not found.
+    template <typename FN>
+    uint32_t find_latest(const Item * items, uint8_t count, uint32_t pending, FN fn)
+    {
+        uint32_t deleted = 0;
+
+        for (uint32_t ofs = next_write_offset; pending && ofs > BANK_HEADER_SIZE;)
+        {
+            ofs -= RECORD_SIZE;
+
+            uint16_t addr = get_addr(current_bank, ofs);
+            uint32_t matched = 0;
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                if ((pending & (1UL << i)) && items[i].addr == addr) matched |= 1UL << i;
+            }
+
+            if (!matched) continue;
+
+            uint16_t mark = get_mark(current_bank, ofs);
+
+            if (!is_committed(current_bank, ofs, next_write_offset, mark, addr)) continue;
+
+            pending &= ~matched;
+
+            if (mark == GROUP_DELETE_MARK)
+            {
+                deleted |= matched;
+                continue;
+            }
+
+            uint32_t val = get_value(current_bank, ofs);
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                if (matched & (1UL << i)) fn(i, val);
+            }
+        }
+
+        return pending | deleted;
     }
 
+    // Write changed items and delete existing ones, selected by `del_mask`.
+    // New addresses are accepted only if all data would still fit into bank
+    // after compaction. Returns false if nothing written due to no space.
+    bool write_items(const Item * items, uint8_t count, uint32_t del_mask)
+    {
+        if (count > MAX_BATCH_SIZE) count = MAX_BATCH_SIZE;
+
+        uint32_t pending = (count < 32) ? (1UL << count) - 1 : UINT32_MAX;
+        uint32_t changed = 0;
+        uint32_t existing = 0;
+
+        // If address repeats, the last item wins
+        for (uint8_t i = 0; i < count; i++)
+        {
+            for (uint8_t j = i + 1; j < count; j++)
+            {
+                if (items[i].addr == items[j].addr) { pending &= ~(1UL << i); break; }
+            }
+        }
+
+        pending = find_latest(items, count, pending, [&](uint8_t i, uint32_t val) {
+            existing |= 1UL << i;
+            if (items[i].value != val || (del_mask & (1UL << i))) changed |= 1UL << i;
+        });
+
+        // Nothing to delete for not existing values
+        pending &= ~del_mask;
+        del_mask &= existing;
+
+        // Not existing values should be written too. Those grow data, so
+        // check it survives the next bank move.
+        if (pending &&
+            move_records(current_bank, current_bank ^ 1, items, count,
+                         changed | pending, del_mask, false) > RECORDS_END)
+        {
+            return false;
+        }
+
+        return append(items, count, changed | pending, del_mask);
+    }
+
+    // Mount: active bank is detected by headers only, full bank scan is
+    // needed only when no valid banks exist (first start).
     void init()
     {
         initialized = true;
 
-        if (is_active(0)) current_bank = 0;
-        else if (is_active(1)) current_bank = 1;
+        bool active0 = is_active(0);
+        bool active1 = is_active(1);
+
+        if (active0 && active1)
+        {
+            // Bank move was interrupted right after new marker. New bank is
+            // complete, finish cleanup of old one.
+            current_bank = is_newer(1, 0) ? 1 : 0;
+            flash.unlock();
+            write_bank_dirty_mark(current_bank ^ 1);
+            erase(current_bank ^ 1);
+            flash.lock();
+        }
+        else if (active0) current_bank = 0;
+        else if (active1) current_bank = 1;
         else
         {
             // Both banks have no valid markers => prepare first one
-            if (!is_clear(0)) flash.erase(0);
-            flash.write_u16(0, 0, BANK_MARK);
+            flash.unlock();
+            if (!is_clear(0)) erase(0);
+            write_bank_mark(0);
+            flash.lock();
             current_bank = 0;
         }
 
+        stats.generation = get_generation(current_bank);
         next_write_offset = find_write_offset();
         return;
     }
@@ -167,6 +723,36 @@ class EepromEmu
 public:
     FLASH_DRIVER flash;
 
+    enum { MAX_BATCH_SIZE = 32 };
+
+    enum {
+        BLOB_COUNT = 64,
+        // Blob with length chunk should fit into single batch
+        BLOB_MAX_SIZE = (MAX_BATCH_SIZE - 1) * 4
+    };
+
+    static Item item_u32(uint16_t addr, uint32_t val) { return { addr, val }; }
+
+    static Item item_float(uint16_t addr, float val)
+    {
+        union { uint32_t i; float f; } x;
+        x.f = val;
+        return { addr, x.i };
+    }
+
+    // Write amplification is (user_bytes + compaction_bytes) / user_bytes
+    const Stats & get_stats()
+    {
+        if (!initialized) init();
+        return stats;
+    }
+
+    // Mount storage. Optional, done on first access if not called.
+    void mount()
+    {
+        if (!initialized) init();
+    }
+
     uint32_t read_u32(uint16_t addr, uint32_t dflt)
     {
         if (!initialized) init();
@@ -178,41 +764,166 @@ public:
 
             ofs -= RECORD_SIZE;
 
-            if (flash.read_u16(current_bank, ofs + 0) != COMMIT_MARK) continue;
-            if (flash.read_u16(current_bank, ofs + 2) != addr) continue;
+            if (get_addr(current_bank, ofs) != addr) continue;
+            uint16_t mark = get_mark(current_bank, ofs);
 
-            uint16_t lo = flash.read_u16(current_bank, ofs + 4);
-            uint16_t hi = flash.read_u16(current_bank, ofs + 6);
+            if (!is_committed(current_bank, ofs, next_write_offset, mark, addr)) continue;
+            if (mark == GROUP_DELETE_MARK) break;
 
-            return (hi << 16) + lo;
+            return get_value(current_bank, ofs);
         }
 
         return dflt;
     }
 
-    void write_u32(uint16_t addr, uint32_t val)
+    // Read multiple values with single scan. Items should be filled with
+    // default values, those are replaced with stored ones.
+    void read_batch(Item * items, uint8_t count)
+    {
+        if (!initialized) init();
+
+        if (count > MAX_BATCH_SIZE) count = MAX_BATCH_SIZE;
+
+        uint32_t pending = (count < 32) ? (1UL << count) - 1 : UINT32_MAX;
+
+        find_latest(items, count, pending, [&](uint8_t i, uint32_t val) {
+            items[i].value = val;
+        });
+    }
+
+    // Returns false if value is new and bank has no space for it
+    bool write_u32(uint16_t addr, uint32_t val)
+    {
+        Item item = { addr, val };
+        return write_batch(&item, 1);
+    }
+
+    // Write multiple values atomically - after power loss all of them will
+    // have new values or all of them will have old ones. Unchanged values are
+    // skipped, with single scan for all items. Returns false if nothing
+    // written, because new values would not fit after bank move.
+    bool write_batch(const Item * items, uint8_t count)
+    {
+        if (!initialized) init();
+
+        return write_items(items, count, 0);
+    }
+
+    // Counters are for frequent increments, see format description
+    uint32_t read_counter(uint8_t id)
     {
+        if (id >= COUNTERS) return 0;
         if (!initialized) init();
 
-        uint8_t bank = current_bank;
+        return read_u32(COUNTER_ADDR + id, 0) + tally_count(current_bank, id);
+    }
 
-        // Don't write the same value
-        uint32_t previous = read_u32(addr, val+1);
-        if (previous == val) return;
+    // Single increments go to tally. Bigger steps and overflow are written
+    // to base record.
+    void increment_counter(uint8_t id, uint32_t n = 1)
+    {
+        if (id >= COUNTERS || !n) return;
+        if (!initialized) init();
 
-        // Check free space and swap banks if needed
-        if (next_write_offset + RECORD_SIZE > FLASH_DRIVER::BankSize)
+        uint32_t used = tally_count(current_bank, id);
+
+        if (n == 1 && used < TALLY_UNITS)
         {
-            move_bank(bank, bank ^ 1, addr);
-            bank ^= 1;
+            const uint16_t zero[4] = { 0, 0, 0, 0 };
+
+            flash.unlock();
+            program(current_bank, tally_offset(id) + used * PROGRAM_SIZE, zero);
+            flash.lock();
+            stats.user_bytes += PROGRAM_SIZE;
+            return;
         }
 
-        // Write data
-        flash.write_u16(bank, next_write_offset + 2, addr);
-        flash.write_u16(bank, next_write_offset + 4, val & 0xFFFF);
-        flash.write_u16(bank, next_write_offset + 6, (uint16_t)(val >> 16) & 0xFFFF);
-        flash.write_u16(bank, next_write_offset + 0, COMMIT_MARK);
-        next_write_offset += RECORD_SIZE;
+        Item item = { (uint16_t)(COUNTER_ADDR + id), read_u32(COUNTER_ADDR + id, 0) + n };
+        append(&item, 1, 1);
+    }
+
+    // Blob length, -1 if not exists
+    int32_t blob_length(uint8_t id)
+    {
+        if (id >= BLOB_COUNT) return -1;
+
+        uint32_t len = read_u32(blob_addr(id, 0), UINT32_MAX);
+
+        return len <= BLOB_MAX_SIZE ? (int32_t)len : -1;
+    }
+
+    // Stream blob to `fn(offset, data, len)` by chunks, without buffering
+    // the whole blob in RAM. Returns blob length, -1 if not exists.
+    template <typename FN>
+    int32_t read_blob(uint8_t id, FN fn)
+    {
+        int32_t len = blob_length(id);
+
+        // Chunks are fetched by small windows, with single scan per window
+        enum { WINDOW = 8 };
+
+        for (int32_t ofs = 0; ofs < len; ofs += WINDOW * 4)
+        {
+            Item items[WINDOW];
+            uint8_t count = 0;
+
+            for (; count < WINDOW && ofs + count * 4 < len; count++)
+            {
+                items[count] = item_u32(blob_addr(id, 1 + ofs / 4 + count), 0);
+            }
+
+            read_batch(items, count);
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                uint32_t pos = ofs + i * 4;
+                uint32_t val = items[i].value;
+                const uint8_t chunk[4] = {
+                    (uint8_t)val, (uint8_t)(val >> 8), (uint8_t)(val >> 16), (uint8_t)(val >> 24)
+                };
+
+                fn(pos, chunk, (len - pos) < 4 ? (len - pos) : 4);
+            }
+        }
+
+        return len;
+    }
+
+    // Write blob atomically. Returns false if blob is too big, or storage
+    // has no space for it.
+    bool write_blob(uint8_t id, const uint8_t * data, uint32_t len)
+    {
+        if (id >= BLOB_COUNT || len > BLOB_MAX_SIZE) return false;
+        if (!initialized) init();
+
+        int32_t old_len = blob_length(id);
+        uint8_t chunks = (len + 3) / 4;
+        uint8_t old_chunks = old_len > 0 ? (old_len + 3) / 4 : 0;
+
+        Item items[MAX_BATCH_SIZE];
+        uint8_t count = 0;
+        uint32_t del_mask = 0;
+
+        // Drop trailing chunks of shrunk blob, to not copy those on bank move
+        for (uint8_t seq = chunks + 1; seq <= old_chunks; seq++)
+        {
+            del_mask |= 1UL << count;
+            items[count++] = item_u32(blob_addr(id, seq), 0);
+        }
+
+        for (uint32_t ofs = 0; ofs < len; ofs += 4)
+        {
+            uint32_t val = 0;
+
+            for (uint32_t i = 0; i < 4 && ofs + i < len; i++) val |= (uint32_t)data[ofs + i] << (i * 8);
+
+            items[count++] = item_u32(blob_addr(id, 1 + ofs / 4), val);
+        }
+
+        // Length goes last, it commits group
+        items[count++] = item_u32(blob_addr(id, 0), len);
+
+        return write_items(items, count, del_mask);
     }
 
     float read_float(uint16_t addr, float dflt)
@@ -223,11 +934,11 @@ public:
         return x.f;
     }
 
-    void write_float(uint16_t addr, float val)
+    bool write_float(uint16_t addr, float val)
     {
         union { uint32_t i; float f; } x;
         x.f = val;
-        write_u32(addr, x.i);
+        return write_u32(addr, x.i);
     }
 };
 
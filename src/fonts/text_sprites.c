@@ -0,0 +1,1666 @@
+#include "text_sprites.h"
+
+/*******************************************************************************
+ * Generated by support/build_sprites.js, do not edit.
+ * Sprites: 16, data: 12486 bytes
+ ******************************************************************************/
+
+#if TEXT_SPRITES
+
+/* "Syringe dia", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_0[] = {
+    0x3, 0x1, 0x6, 0x0, 0x25, 0x8b, 0xcd, 0xef,
+    0xff, 0xed, 0xb8, 0x52, 0x14, 0x3, 0x0, 0x49,
+    0xef, 0xd8, 0x30, 0x39, 0x6, 0x5a, 0xff, 0xfb,
+    0x50, 0x0, 0x4, 0x9e, 0xfd, 0x83, 0x3, 0x0,
+    0x8, 0x0, 0x15, 0xbe, 0xff, 0xec, 0xa8, 0x88,
+    0x8a, 0xce, 0xff, 0xeb, 0x51, 0x14, 0x3, 0x0,
+    0x38, 0xcd, 0xb6, 0x20, 0x39, 0x6, 0x5a, 0xff,
+    0xfb, 0x50, 0x0, 0x3, 0x8c, 0xdb, 0x62, 0x2,
+    0x0, 0x9, 0x1, 0x6c, 0xff, 0xfa, 0x50, 0x0,
+    0x0, 0x0, 0x4, 0xae, 0xff, 0xd7, 0x20, 0x0,
+    0x39, 0x3, 0x5a, 0xff, 0xfb, 0x50, 0x0, 0x2,
+    0x0, 0x2f, 0x1, 0x7c, 0xff, 0xfb, 0x61, 0x0,
+    0x0, 0x0, 0x0, 0x23, 0x44, 0x33, 0x7c, 0xff,
+    0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xff, 0xe8,
+    0x30, 0x27, 0xdf, 0xfd, 0xa8, 0xad, 0xef, 0xb6,
+    0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x2, 0x8d,
+    0xff, 0xc8, 0x69, 0xcd, 0xff, 0xfe, 0xca, 0x62,
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x9c, 0xef, 0xfe,
+    0xdc, 0x97, 0x9c, 0xff, 0xc6, 0x10, 0x0, 0x0,
+    0x3, 0x69, 0xcd, 0xff, 0xfe, 0xdb, 0x95, 0x20,
+    0x0, 0x35, 0x12, 0x2, 0x6a, 0xce, 0xff, 0xed,
+    0xb8, 0x9b, 0xff, 0xfb, 0x50, 0x0, 0x6, 0xbf,
+    0xff, 0xa4, 0x0, 0x0, 0x0, 0x3, 0x69, 0xcd,
+    0xef, 0xff, 0xed, 0xb8, 0x41, 0x0, 0x2, 0x0,
+    0x2f, 0x0, 0x15, 0xbe, 0xff, 0xfe, 0xca, 0x86,
+    0x42, 0x0, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xff,
+    0xa5, 0x0, 0x0, 0x27, 0xdf, 0xfe, 0x83, 0x0,
+    0x27, 0xdf, 0xff, 0xfe, 0xdb, 0xa9, 0x63, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x2, 0x8d, 0xff,
+    0xff, 0xeb, 0x98, 0x79, 0xbe, 0xff, 0xfb, 0x61,
+    0x0, 0x0, 0x28, 0xdf, 0xff, 0xdb, 0x88, 0x89,
+    0xbe, 0xff, 0xff, 0xc6, 0x10, 0x0, 0x16, 0xbf,
+    0xff, 0xda, 0x77, 0x78, 0xbe, 0xff, 0xd8, 0x30,
+    0x34, 0x13, 0x0, 0x38, 0xdf, 0xff, 0xdb, 0x88,
+    0x8a, 0xce, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x6b,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x5a, 0xef, 0xfd,
+    0xa7, 0x66, 0x79, 0xcf, 0xff, 0xb6, 0x10, 0x2,
+    0x1, 0x2f, 0x0, 0x25, 0x8b, 0xef, 0xff, 0xff,
+    0xff, 0xda, 0x74, 0x10, 0x0, 0x16, 0xcf, 0xfe,
+    0x94, 0x0, 0x17, 0xcf, 0xfe, 0x93, 0x0, 0x2,
+    0x7d, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0, 0x6,
+    0xbf, 0xff, 0xa4, 0x0, 0x0, 0x28, 0xdf, 0xfd,
+    0x83, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xe9, 0x30,
+    0x0, 0x39, 0xef, 0xfd, 0x83, 0x0, 0x0, 0x0,
+    0x49, 0xef, 0xfc, 0x61, 0x0, 0x38, 0xdf, 0xfc,
+    0x72, 0x0, 0x0, 0x1, 0x5a, 0xff, 0xe9, 0x40,
+    0x0, 0x34, 0x13, 0x4, 0x9e, 0xff, 0xd8, 0x20,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xb5, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x1, 0x24, 0x55,
+    0x42, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x3, 0x2d, 0x1, 0x24, 0x68, 0xbd, 0xff,
+    0xff, 0xc7, 0x20, 0x1, 0x6c, 0xff, 0xe9, 0x31,
+    0x6b, 0xff, 0xe9, 0x30, 0x0, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x0, 0x6, 0xbf, 0xff,
+    0xa4, 0x0, 0x0, 0x28, 0xdf, 0xfd, 0x72, 0x0,
+    0x0, 0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x0, 0x0, 0x0, 0x49, 0xef,
+    0xfc, 0x61, 0x1, 0x6b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x60, 0x0, 0x34,
+    0x13, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x0, 0x0,
+    0x5, 0xaf, 0xff, 0xb5, 0x0, 0x0, 0x6b, 0xff,
+    0xfa, 0x40, 0x0, 0x0, 0x1, 0x36, 0x9b, 0xcd,
+    0xee, 0xff, 0xff, 0xff, 0xfb, 0x50, 0x2, 0x0,
+    0x30, 0x2, 0x45, 0x55, 0x31, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xae, 0xff, 0xd8, 0x30, 0x1, 0x6b,
+    0xff, 0xd8, 0x8a, 0xff, 0xe9, 0x40, 0x0, 0x0,
+    0x27, 0xdf, 0xfd, 0x83, 0x0, 0x0, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x2, 0x8d, 0xff,
+    0xd7, 0x20, 0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4,
+    0x0, 0x5, 0xbf, 0xfe, 0x94, 0x0, 0x0, 0x0,
+    0x4, 0x9e, 0xff, 0xc6, 0x10, 0x6, 0xbf, 0xff,
+    0xb7, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x21,
+    0x0, 0x34, 0x13, 0x6, 0xbf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5, 0xaf, 0xff, 0xb5, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x1, 0x6b, 0xff,
+    0xec, 0x85, 0x32, 0x22, 0x6b, 0xff, 0xfb, 0x50,
+    0x2, 0x0, 0x2f, 0x5, 0xaf, 0xff, 0xc7, 0x20,
+    0x0, 0x0, 0x0, 0x3, 0x8d, 0xff, 0xd8, 0x20,
+    0x0, 0x16, 0xcf, 0xff, 0xff, 0xfe, 0x94, 0x0,
+    0x0, 0x0, 0x27, 0xdf, 0xfd, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x2,
+    0x8d, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x6, 0xbf,
+    0xff, 0xa4, 0x0, 0x3, 0x8e, 0xff, 0xd8, 0x20,
+    0x0, 0x0, 0x4, 0xae, 0xff, 0xc6, 0x10, 0x3,
+    0x8e, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0, 0x13,
+    0x32, 0x0, 0x34, 0x13, 0x3, 0x9e, 0xff, 0xb6,
+    0x10, 0x0, 0x0, 0x5, 0xaf, 0xff, 0xb5, 0x0,
+    0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x5, 0xaf,
+    0xff, 0xa5, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xfb,
+    0x50, 0x2, 0x0, 0x30, 0x0, 0x38, 0xdf, 0xff,
+    0xec, 0x98, 0x77, 0x89, 0xbd, 0xff, 0xfd, 0x83,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xe9, 0x40,
+    0x0, 0x0, 0x0, 0x27, 0xdf, 0xfd, 0x83, 0x0,
+    0x0, 0x0, 0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0,
+    0x2, 0x8d, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x6,
+    0xbf, 0xff, 0xa4, 0x0, 0x0, 0x27, 0xdf, 0xff,
+    0xdb, 0x87, 0x89, 0xce, 0xff, 0xff, 0xc6, 0x10,
+    0x0, 0x16, 0xbf, 0xff, 0xec, 0x97, 0x77, 0x8a,
+    0xdf, 0xfb, 0x61, 0x0, 0x34, 0x13, 0x0, 0x28,
+    0xdf, 0xfe, 0xc8, 0x65, 0x67, 0xbd, 0xff, 0xff,
+    0xb5, 0x0, 0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0,
+    0x3, 0x8d, 0xff, 0xfc, 0xa7, 0x77, 0x9c, 0xef,
+    0xff, 0xfb, 0x60, 0x2, 0x1, 0x2e, 0x1, 0x36,
+    0x9b, 0xde, 0xff, 0xff, 0xed, 0xca, 0x74, 0x10,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe9, 0x40,
+    0x0, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4, 0x0,
+    0x0, 0x28, 0xdf, 0xfd, 0x72, 0x0, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x2, 0x59,
+    0xce, 0xff, 0xed, 0xc9, 0x9b, 0xef, 0xfb, 0x61,
+    0x0, 0x0, 0x1, 0x37, 0xac, 0xde, 0xff, 0xfe,
+    0xdb, 0x85, 0x20, 0x35, 0x13, 0x2, 0x6a, 0xce,
+    0xff, 0xed, 0xc9, 0x8a, 0xef, 0xfb, 0x50, 0x0,
+    0x6, 0xbf, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x36,
+    0xac, 0xef, 0xfe, 0xdb, 0x87, 0xad, 0xff, 0xd8,
+    0x20, 0x0, 0x2, 0xa, 0x3, 0x49, 0xef, 0xe9,
+    0x40, 0x0, 0x21, 0x7, 0x1, 0x21, 0x0, 0x0,
+    0x0, 0x1, 0x6b, 0xff, 0xf9, 0x40, 0x0, 0x2,
+    0x8, 0x4, 0x2, 0x58, 0x9b, 0xef, 0xfd, 0x83,
+    0x20, 0x7, 0x0, 0x27, 0xdf, 0xec, 0x98, 0x77,
+    0x7a, 0xcf, 0xff, 0xd8, 0x30, 0x2, 0x8, 0x4,
+    0x4, 0x9f, 0xff, 0xdb, 0x73, 0x0, 0x21, 0x6,
+    0x13, 0x79, 0xcd, 0xef, 0xfe, 0xed, 0xb8, 0x52,
+    0x0,
+};
+
+/* "Viscosity", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_1[] = {
+    0x3, 0x0, 0x4, 0x0, 0x16, 0xbf, 0xff, 0xd7,
+    0x20, 0x7, 0x6, 0x1, 0x6c, 0xff, 0xfc, 0x71,
+    0x4, 0x9e, 0xfd, 0x83, 0x2b, 0x3, 0x0, 0x49,
+    0xef, 0xd8, 0x30, 0x3, 0x1, 0x3, 0x16, 0xbf,
+    0xff, 0xc7, 0x20, 0x7, 0x6, 0x16, 0xbf, 0xff,
+    0xc7, 0x20, 0x3, 0x8c, 0xdb, 0x62, 0x2b, 0x8,
+    0x0, 0x38, 0xcd, 0xb6, 0x20, 0x0, 0x0, 0x16,
+    0xbf, 0xff, 0x94, 0x0, 0x2, 0x1, 0x9, 0x1,
+    0x6b, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x1,
+    0x6b, 0xff, 0xfc, 0x72, 0x0, 0x2f, 0x4, 0x0,
+    0x16, 0xbf, 0xff, 0x94, 0x0, 0x1, 0x1, 0x3a,
+    0x0, 0x16, 0xbf, 0xff, 0xb6, 0x10, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xc7, 0x20, 0x0, 0x6, 0xbf,
+    0xff, 0xa4, 0x0, 0x0, 0x0, 0x13, 0x7a, 0xce,
+    0xef, 0xfe, 0xdc, 0x96, 0x31, 0x0, 0x0, 0x0,
+    0x14, 0x8b, 0xde, 0xff, 0xfe, 0xdb, 0x85, 0x20,
+    0x0, 0x0, 0x1, 0x37, 0xac, 0xef, 0xff, 0xfe,
+    0xca, 0x63, 0x0, 0x0, 0x0, 0x0, 0x13, 0x7a,
+    0xce, 0xef, 0xfe, 0xdc, 0x96, 0x31, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x4, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x93, 0x16, 0xcf, 0xff, 0xb5,
+    0x0, 0x0, 0x0, 0x38, 0xef, 0xfe, 0x83, 0x1,
+    0x2, 0x39, 0x16, 0xbf, 0xff, 0xb5, 0x10, 0x0,
+    0x5, 0xaf, 0xff, 0xc7, 0x20, 0x0, 0x0, 0x6b,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x5a, 0xff, 0xfc,
+    0x96, 0x55, 0x7a, 0xdf, 0xfe, 0xa4, 0x0, 0x2,
+    0x7c, 0xff, 0xfd, 0xa8, 0x77, 0x9c, 0xef, 0xfd,
+    0x83, 0x0, 0x27, 0xcf, 0xff, 0xdb, 0x87, 0x78,
+    0xbe, 0xff, 0xeb, 0x51, 0x0, 0x0, 0x5a, 0xff,
+    0xfc, 0x96, 0x55, 0x7a, 0xdf, 0xfe, 0xa4, 0x0,
+    0x6, 0xbf, 0xff, 0xa4, 0x0, 0x13, 0x45, 0x9d,
+    0xff, 0xfb, 0x75, 0x42, 0x10, 0x16, 0xcf, 0xff,
+    0xa5, 0x0, 0x0, 0x27, 0xdf, 0xfe, 0x83, 0x0,
+    0x1, 0x2, 0x39, 0x1, 0x6c, 0xff, 0xfa, 0x50,
+    0x0, 0x4a, 0xff, 0xfd, 0x72, 0x0, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x3, 0x8d, 0xff,
+    0xc7, 0x20, 0x0, 0x0, 0x35, 0x77, 0x63, 0x10,
+    0x39, 0xef, 0xfc, 0x71, 0x0, 0x0, 0x1, 0x6b,
+    0xee, 0xc7, 0x23, 0x8e, 0xff, 0xd7, 0x20, 0x0,
+    0x0, 0x3, 0x8d, 0xff, 0xd7, 0x20, 0x3, 0x8d,
+    0xff, 0xc7, 0x20, 0x0, 0x0, 0x35, 0x77, 0x63,
+    0x10, 0x6, 0xbf, 0xff, 0xa4, 0x0, 0x0, 0x1,
+    0x6b, 0xff, 0xf9, 0x40, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xe9, 0x40, 0x1, 0x7c, 0xff, 0xe9, 0x30,
+    0x0, 0x2, 0x2, 0x16, 0x0, 0x17, 0xcf, 0xff,
+    0xa4, 0x4, 0x9e, 0xff, 0xd8, 0x20, 0x0, 0x0,
+    0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x27,
+    0xce, 0xff, 0xfe, 0xcb, 0x98, 0x64, 0x20, 0x0,
+    0x1, 0x6b, 0xff, 0xe9, 0x30, 0x1c, 0x1e, 0x16,
+    0xbf, 0xfe, 0x94, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xff, 0xfb, 0x50, 0x0, 0x27, 0xce, 0xff, 0xfe,
+    0xcb, 0x98, 0x64, 0x20, 0x0, 0x0, 0x6, 0xbf,
+    0xff, 0xa4, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xf9,
+    0x40, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x16, 0xbf, 0xfe, 0x93, 0x2, 0x3, 0x15, 0x17,
+    0xcf, 0xfe, 0x98, 0x9e, 0xff, 0xd8, 0x20, 0x0,
+    0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4, 0x0, 0x0,
+    0x0, 0x0, 0x13, 0x57, 0x8a, 0xbd, 0xff, 0xff,
+    0xd8, 0x30, 0x16, 0xbf, 0xfe, 0x93, 0x0, 0x1c,
+    0x1e, 0x6, 0xbf, 0xfe, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x49, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x1,
+    0x35, 0x78, 0xab, 0xdf, 0xff, 0xfd, 0x83, 0x0,
+    0x6, 0xbf, 0xff, 0xa4, 0x0, 0x0, 0x1, 0x6b,
+    0xff, 0xf9, 0x40, 0x0, 0x0, 0x0, 0x1, 0x6b,
+    0xff, 0xd8, 0x8a, 0xff, 0xe9, 0x40, 0x1, 0x3,
+    0x37, 0x2, 0x7c, 0xff, 0xff, 0xff, 0xfd, 0x82,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4,
+    0x0, 0x1, 0x47, 0x99, 0x84, 0x10, 0x0, 0x0,
+    0x17, 0xcf, 0xfe, 0x94, 0x3, 0x9e, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x4, 0x8b, 0xb9, 0x52, 0x38,
+    0xef, 0xfd, 0x72, 0x0, 0x0, 0x0, 0x38, 0xdf,
+    0xfd, 0x83, 0x1, 0x47, 0x99, 0x84, 0x10, 0x0,
+    0x0, 0x17, 0xcf, 0xfe, 0x94, 0x0, 0x6b, 0xff,
+    0xfa, 0x40, 0x0, 0x0, 0x6, 0xbf, 0xff, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xff,
+    0xff, 0xe9, 0x40, 0x0, 0x1, 0x3, 0x36, 0x0,
+    0x27, 0xcf, 0xff, 0xff, 0xd8, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4, 0x0, 0x0,
+    0x38, 0xdf, 0xfe, 0xb8, 0x65, 0x56, 0x8c, 0xef,
+    0xfb, 0x61, 0x0, 0x27, 0xcf, 0xff, 0xca, 0x77,
+    0x79, 0xbe, 0xff, 0xd8, 0x30, 0x1, 0x6b, 0xff,
+    0xfd, 0xb8, 0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x20,
+    0x0, 0x38, 0xdf, 0xfe, 0xb8, 0x65, 0x56, 0x8c,
+    0xef, 0xfb, 0x61, 0x0, 0x6b, 0xff, 0xfa, 0x40,
+    0x0, 0x0, 0x4, 0xaf, 0xff, 0xeb, 0x87, 0x42,
+    0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xfe, 0x94,
+    0x2, 0x4, 0x3, 0x27, 0xcf, 0xff, 0xd8, 0x30,
+    0xa, 0x2f, 0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0,
+    0x0, 0x2, 0x58, 0xbd, 0xef, 0xff, 0xee, 0xca,
+    0x74, 0x10, 0x0, 0x0, 0x1, 0x48, 0xbd, 0xef,
+    0xff, 0xed, 0xb8, 0x52, 0x0, 0x0, 0x0, 0x13,
+    0x7a, 0xce, 0xff, 0xfe, 0xdc, 0xa7, 0x31, 0x0,
+    0x0, 0x0, 0x2, 0x58, 0xbd, 0xef, 0xff, 0xee,
+    0xca, 0x74, 0x10, 0x0, 0x6, 0xbf, 0xff, 0xa4,
+    0x0, 0x0, 0x0, 0x2, 0x6b, 0xdf, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x94,
+    0x0, 0x1, 0x36, 0x3, 0x49, 0xef, 0xe9, 0x40,
+    0x0, 0x1, 0x34, 0x4, 0x2, 0x58, 0x9b, 0xef,
+    0xfd, 0x83, 0x1, 0x34, 0x4, 0x4, 0x9f, 0xff,
+    0xdb, 0x73, 0x0,
+};
+
+/* "Flux part", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_2[] = {
+    0x1, 0x0, 0xb, 0x0, 0x5a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x2, 0x0, 0xb, 0x0,
+    0x5a, 0xff, 0xfd, 0xb8, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0x20, 0x0, 0x6b, 0xff, 0xfa, 0x40,
+    0x34, 0x4, 0x0, 0x16, 0xbf, 0xff, 0x94, 0x0,
+    0x3, 0x0, 0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61,
+    0x0, 0x8, 0x3, 0x0, 0x6b, 0xff, 0xfa, 0x40,
+    0x34, 0x4, 0x0, 0x16, 0xbf, 0xff, 0x94, 0x0,
+    0x3, 0x0, 0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61,
+    0x0, 0x8, 0x13, 0x0, 0x6b, 0xff, 0xfa, 0x40,
+    0x0, 0x3, 0x8d, 0xff, 0xc7, 0x20, 0x0, 0x0,
+    0x6, 0xbf, 0xff, 0x94, 0x0, 0x16, 0xbf, 0xff,
+    0xb6, 0x10, 0x0, 0x15, 0xaf, 0xff, 0xc7, 0x20,
+    0x1f, 0x1a, 0x2, 0x7d, 0xff, 0xca, 0x8a, 0xce,
+    0xff, 0xfe, 0xc9, 0x52, 0x0, 0x0, 0x0, 0x0,
+    0x36, 0x9c, 0xde, 0xff, 0xfe, 0xdb, 0x84, 0x10,
+    0x0, 0x0, 0x2, 0x7d, 0xff, 0xda, 0x8a, 0xde,
+    0xfb, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
+    0x30, 0x2, 0x0, 0x1b, 0x0, 0x5a, 0xff, 0xfc,
+    0x73, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0,
+    0x0, 0x6b, 0xff, 0xfa, 0x40, 0x0, 0x3, 0x8d,
+    0xff, 0xc7, 0x20, 0x0, 0x0, 0x6, 0xbf, 0xff,
+    0x94, 0x0, 0x0, 0x28, 0xdf, 0xfe, 0x93, 0x3,
+    0x9d, 0xff, 0xd9, 0x30, 0x0, 0x1f, 0x1a, 0x2,
+    0x7d, 0xff, 0xff, 0xc9, 0x65, 0x57, 0xad, 0xff,
+    0xfc, 0x61, 0x0, 0x0, 0x5a, 0xef, 0xfd, 0xa7,
+    0x66, 0x79, 0xcf, 0xff, 0xb6, 0x10, 0x0, 0x2,
+    0x7d, 0xff, 0xff, 0xed, 0xba, 0x96, 0x43, 0x45,
+    0x9d, 0xff, 0xfb, 0x75, 0x42, 0x10, 0x2, 0x0,
+    0x1a, 0x0, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x6b, 0xff,
+    0xfa, 0x40, 0x0, 0x3, 0x8d, 0xff, 0xc7, 0x20,
+    0x0, 0x0, 0x6, 0xbf, 0xff, 0x94, 0x0, 0x0,
+    0x0, 0x49, 0xef, 0xfd, 0xcd, 0xff, 0xea, 0x51,
+    0x1f, 0x19, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x3, 0x9e, 0xff, 0xc7, 0x20, 0x1, 0x24,
+    0x55, 0x42, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x0, 0x2, 0x7d, 0xff, 0xe9, 0x40, 0x0,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xf9, 0x40, 0x0,
+    0x2, 0x0, 0x1a, 0x0, 0x5a, 0xff, 0xfd, 0x95,
+    0x55, 0x55, 0x55, 0x55, 0x53, 0x20, 0x0, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x3, 0x8d, 0xff,
+    0xc7, 0x20, 0x0, 0x0, 0x6, 0xbf, 0xff, 0x94,
+    0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xfc,
+    0x61, 0x0, 0x1f, 0x19, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xf9, 0x40,
+    0x0, 0x1, 0x36, 0x9b, 0xcd, 0xee, 0xff, 0xff,
+    0xff, 0xfb, 0x50, 0x0, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xf9,
+    0x40, 0x0, 0x3, 0x0, 0x4, 0x0, 0x5a, 0xff,
+    0xfb, 0x61, 0x0, 0x8, 0x12, 0x0, 0x6b, 0xff,
+    0xfa, 0x40, 0x0, 0x3, 0x8d, 0xff, 0xc7, 0x20,
+    0x0, 0x0, 0x6, 0xbf, 0xff, 0x94, 0x0, 0x0,
+    0x0, 0x2, 0x7c, 0xff, 0xff, 0xfc, 0x72, 0x0,
+    0x1f, 0x19, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x1, 0x6b, 0xff, 0xf9, 0x40, 0x1, 0x6b,
+    0xff, 0xec, 0x85, 0x32, 0x22, 0x6b, 0xff, 0xfb,
+    0x50, 0x0, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xf9, 0x40, 0x0,
+    0x4, 0x0, 0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61,
+    0x0, 0x8, 0x12, 0x0, 0x6b, 0xff, 0xfa, 0x40,
+    0x0, 0x2, 0x7c, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x17, 0xcf, 0xff, 0x94, 0x0, 0x0, 0x1, 0x5a,
+    0xff, 0xfc, 0xbb, 0xff, 0xfb, 0x61, 0x1f, 0x13,
+    0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0, 0x4,
+    0x9e, 0xff, 0xc7, 0x20, 0x5, 0xaf, 0xff, 0xa5,
+    0x0, 0x0, 0x0, 0x5b, 0xff, 0xfb, 0x50, 0x0,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x35, 0x3, 0x6b,
+    0xff, 0xf9, 0x40, 0x0, 0x4, 0x0, 0x4, 0x0,
+    0x5a, 0xff, 0xfb, 0x61, 0x0, 0x8, 0x13, 0x0,
+    0x6b, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x49, 0xef,
+    0xfe, 0xc9, 0x77, 0x8a, 0xdf, 0xff, 0xff, 0x94,
+    0x0, 0x0, 0x49, 0xef, 0xfd, 0x83, 0x2, 0x7c,
+    0xff, 0xea, 0x40, 0x0, 0x1f, 0x13, 0x2, 0x7d,
+    0xff, 0xff, 0xdb, 0x87, 0x78, 0xbe, 0xff, 0xfc,
+    0x61, 0x0, 0x3, 0x8d, 0xff, 0xfc, 0xa7, 0x77,
+    0x9c, 0xef, 0xff, 0xfb, 0x60, 0x0, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x35, 0x4, 0x4a, 0xff, 0xfe,
+    0xb8, 0x74, 0x20, 0x4, 0x0, 0x4, 0x0, 0x5a,
+    0xff, 0xfb, 0x61, 0x0, 0x8, 0x13, 0x0, 0x6b,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x1, 0x48, 0xbd,
+    0xef, 0xfe, 0xca, 0x78, 0xbf, 0xff, 0x94, 0x0,
+    0x27, 0xdf, 0xfe, 0xa5, 0x10, 0x0, 0x4, 0x9e,
+    0xff, 0xd8, 0x30, 0x1f, 0x13, 0x2, 0x7d, 0xff,
+    0xea, 0x89, 0xce, 0xff, 0xfe, 0xc9, 0x52, 0x0,
+    0x0, 0x0, 0x3, 0x6a, 0xce, 0xff, 0xed, 0xb8,
+    0x7a, 0xdf, 0xfd, 0x82, 0x0, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x35, 0x4, 0x2, 0x6b, 0xdf, 0xff,
+    0xd8, 0x30, 0x1, 0x1f, 0x3, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x1, 0x1f, 0x3, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x1, 0x1f, 0x3, 0x2, 0x7d, 0xff,
+    0xd8, 0x30,
+};
+
+/* "Fast move", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_3[] = {
+    0x1, 0x0, 0x8, 0x0, 0x5a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x2,
+    0x0, 0x8, 0x0, 0x5a, 0xff, 0xfd, 0xb8, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0x20, 0x16, 0x4,
+    0x0, 0x16, 0xbf, 0xff, 0x94, 0x0, 0x2, 0x0,
+    0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61, 0x0, 0x16,
+    0x4, 0x0, 0x16, 0xbf, 0xff, 0x94, 0x0, 0x3,
+    0x0, 0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61, 0x0,
+    0x8, 0x13, 0x3, 0x69, 0xcd, 0xef, 0xff, 0xed,
+    0xb8, 0x41, 0x0, 0x0, 0x0, 0x0, 0x13, 0x7a,
+    0xce, 0xef, 0xfe, 0xdc, 0x96, 0x31, 0x4, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0x0, 0x1f,
+    0x22, 0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef,
+    0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef, 0xff, 0xec,
+    0xa6, 0x20, 0x0, 0x0, 0x0, 0x13, 0x7a, 0xce,
+    0xff, 0xff, 0xec, 0xa6, 0x30, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x0, 0x0, 0x1, 0x7c, 0xff,
+    0xe9, 0x30, 0x0, 0x0, 0x36, 0x9c, 0xdf, 0xff,
+    0xed, 0xb9, 0x52, 0x0, 0x2, 0x0, 0x1b, 0x0,
+    0x5a, 0xff, 0xfc, 0x73, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x0, 0x5, 0xae, 0xff, 0xda, 0x76, 0x67,
+    0x9c, 0xff, 0xfb, 0x61, 0x0, 0x0, 0x5, 0xaf,
+    0xff, 0xc9, 0x65, 0x57, 0xad, 0xff, 0xea, 0x41,
+    0x34, 0x59, 0xdf, 0xff, 0xb7, 0x54, 0x21, 0x0,
+    0x1f, 0x22, 0x2, 0x7d, 0xff, 0xff, 0xdb, 0x87,
+    0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77, 0x8b,
+    0xdf, 0xff, 0xc6, 0x10, 0x0, 0x27, 0xcf, 0xff,
+    0xdb, 0x87, 0x78, 0xbe, 0xff, 0xeb, 0x51, 0x0,
+    0x5, 0xbf, 0xff, 0x94, 0x0, 0x0, 0x16, 0xbf,
+    0xfe, 0x94, 0x0, 0x1, 0x6b, 0xff, 0xfd, 0xa7,
+    0x77, 0x8b, 0xef, 0xfd, 0x83, 0x2, 0x0, 0x1a,
+    0x0, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x61, 0x12, 0x45, 0x54, 0x20, 0x0,
+    0x0, 0x5, 0xaf, 0xff, 0xa5, 0x0, 0x0, 0x38,
+    0xdf, 0xfc, 0x72, 0x0, 0x0, 0x3, 0x57, 0x76,
+    0x31, 0x0, 0x16, 0xbf, 0xff, 0x94, 0x0, 0x1f,
+    0x23, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x3, 0x8e, 0xff, 0xd7, 0x20,
+    0x0, 0x0, 0x3, 0x8d, 0xff, 0xd7, 0x20, 0x0,
+    0x5b, 0xff, 0xe9, 0x30, 0x0, 0x5a, 0xff, 0xe9,
+    0x40, 0x0, 0x38, 0xdf, 0xfc, 0x72, 0x0, 0x0,
+    0x1, 0x5a, 0xff, 0xe9, 0x40, 0x0, 0x2, 0x0,
+    0x1a, 0x0, 0x5a, 0xff, 0xfd, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x53, 0x20, 0x0, 0x13, 0x69, 0xbc,
+    0xde, 0xef, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
+    0x2, 0x7c, 0xef, 0xff, 0xec, 0xb9, 0x86, 0x42,
+    0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0x94, 0x0,
+    0x1f, 0x23, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x5a, 0xff, 0xfa, 0x50, 0x16, 0xbf, 0xfe, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x49, 0xff, 0xfb, 0x50,
+    0x0, 0x16, 0xbf, 0xfd, 0x82, 0x4, 0xae, 0xfe,
+    0x94, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x60, 0x0, 0x3,
+    0x0, 0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61, 0x0,
+    0x7, 0x13, 0x1, 0x6b, 0xff, 0xec, 0x85, 0x32,
+    0x22, 0x6b, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0,
+    0x1, 0x35, 0x78, 0xab, 0xdf, 0xff, 0xfd, 0x83,
+    0x0, 0x1, 0x6b, 0xff, 0xf9, 0x40, 0x0, 0x1f,
+    0x23, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x6, 0xbf, 0xfe, 0x94, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xff, 0xfb, 0x60, 0x0,
+    0x1, 0x6b, 0xff, 0xc7, 0x59, 0xef, 0xf9, 0x40,
+    0x0, 0x0, 0x6b, 0xff, 0xfb, 0x73, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x32, 0x10, 0x0, 0x3, 0x0,
+    0x4, 0x0, 0x5a, 0xff, 0xfb, 0x61, 0x0, 0x7,
+    0x13, 0x5, 0xaf, 0xff, 0xa5, 0x0, 0x0, 0x0,
+    0x5b, 0xff, 0xfb, 0x50, 0x0, 0x14, 0x79, 0x98,
+    0x41, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xe9, 0x40,
+    0x0, 0x6b, 0xff, 0xf9, 0x40, 0x0, 0x1f, 0x22,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50, 0x3, 0x8e, 0xff, 0xd7, 0x20, 0x0,
+    0x0, 0x3, 0x8d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xbf, 0xfe, 0xee, 0xff, 0xa4, 0x0, 0x0,
+    0x0, 0x38, 0xef, 0xfe, 0x94, 0x0, 0x0, 0x0,
+    0x1, 0x33, 0x20, 0x3, 0x0, 0x4, 0x0, 0x5a,
+    0xff, 0xfb, 0x61, 0x0, 0x7, 0x14, 0x3, 0x8d,
+    0xff, 0xfc, 0xa7, 0x77, 0x9c, 0xef, 0xff, 0xfb,
+    0x60, 0x0, 0x3, 0x8d, 0xff, 0xeb, 0x86, 0x55,
+    0x68, 0xce, 0xff, 0xb6, 0x10, 0x0, 0x4a, 0xff,
+    0xfe, 0xb8, 0x74, 0x20, 0x1f, 0x23, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x0, 0x16, 0xbf, 0xff, 0xdb, 0x87, 0x78, 0xbd,
+    0xff, 0xfc, 0x62, 0x0, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x0, 0x1,
+    0x6b, 0xff, 0xfe, 0xc9, 0x77, 0x78, 0xad, 0xff,
+    0xb6, 0x10, 0x0, 0x5, 0x0, 0x4, 0x0, 0x5a,
+    0xff, 0xfb, 0x61, 0x0, 0x8, 0x13, 0x36, 0xac,
+    0xef, 0xfe, 0xdb, 0x87, 0xad, 0xff, 0xd8, 0x20,
+    0x0, 0x0, 0x25, 0x8b, 0xde, 0xff, 0xfe, 0xec,
+    0xa7, 0x41, 0x0, 0x0, 0x0, 0x26, 0xbd, 0xff,
+    0xfd, 0x83, 0x0, 0x1f, 0x13, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x0,
+    0x0, 0x13, 0x7a, 0xce, 0xff, 0xfe, 0xdc, 0xa7,
+    0x31, 0x0, 0x35, 0x3, 0x16, 0xcf, 0xff, 0xa5,
+    0x0, 0x3b, 0x6, 0x1, 0x37, 0xac, 0xde, 0xff,
+    0xfe, 0xdb, 0x85, 0x20,
+};
+
+/* "0.041 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_4[] = {
+    0x4, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xd, 0x6, 0x1, 0x37,
+    0xac, 0xef, 0xff, 0xfe, 0xca, 0x63, 0x0, 0x18,
+    0x3, 0x5a, 0xef, 0xff, 0xb5, 0x0, 0x1e, 0x4,
+    0x0, 0x13, 0x68, 0xac, 0xd8, 0x30, 0x4, 0x1,
+    0x6, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c, 0xef,
+    0xfe, 0x94, 0xd, 0x6, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x17, 0xb, 0x3,
+    0x9d, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x1,
+    0x48, 0xbd, 0xef, 0xff, 0xff, 0xfe, 0x94, 0x0,
+    0x40, 0x5, 0x2, 0x59, 0xce, 0xff, 0xfe, 0xca,
+    0x62, 0x0, 0x3, 0x0, 0x8, 0x0, 0x5b, 0xff,
+    0xea, 0x40, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5,
+    0x0, 0xc, 0x16, 0x0, 0x5b, 0xff, 0xea, 0x40,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x28, 0xdf, 0xee, 0xef, 0xff,
+    0xb5, 0x0, 0x0, 0x0, 0x28, 0xcd, 0xb9, 0x76,
+    0x9c, 0xff, 0xe9, 0x40, 0x40, 0x5, 0x14, 0x68,
+    0x75, 0x21, 0x39, 0xdf, 0xc7, 0x20, 0x4, 0x0,
+    0x8, 0x3, 0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0,
+    0x2, 0x7d, 0xff, 0xd7, 0x20, 0xc, 0xf, 0x3,
+    0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2, 0x7d,
+    0xff, 0xd7, 0x20, 0x0, 0x0, 0x0, 0x26, 0xcf,
+    0xfc, 0x66, 0xaf, 0xff, 0xb5, 0x0, 0x1f, 0x3,
+    0x16, 0xbf, 0xfe, 0x94, 0x0, 0x28, 0x1d, 0x2,
+    0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef, 0xfe, 0xda,
+    0x62, 0x25, 0x9c, 0xef, 0xff, 0xec, 0xa6, 0x20,
+    0x0, 0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef,
+    0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef, 0xff, 0xec,
+    0xa6, 0x20, 0x0, 0x0, 0x0, 0x27, 0xce, 0xff,
+    0xec, 0x62, 0x0, 0x4, 0x0, 0x8, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe8, 0x30, 0xc, 0xf, 0x4, 0x9f, 0xff, 0xb6,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8, 0x30,
+    0x0, 0x0, 0x15, 0xbe, 0xfc, 0x72, 0x4, 0xaf,
+    0xff, 0xb5, 0x0, 0x1f, 0x3, 0x16, 0xbf, 0xfe,
+    0x94, 0x0, 0x28, 0x1d, 0x2, 0x7d, 0xff, 0xff,
+    0xdb, 0x87, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9,
+    0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x2, 0x7d,
+    0xff, 0xff, 0xdb, 0x87, 0x79, 0xce, 0xff, 0xff,
+    0xfe, 0xb9, 0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x10,
+    0x25, 0x9a, 0x85, 0x21, 0x27, 0xcf, 0xe9, 0x40,
+    0x4, 0x0, 0x8, 0x4, 0x9f, 0xff, 0xb6, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xff, 0xe9, 0x30, 0xc,
+    0xf, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe9, 0x30, 0x0, 0x4, 0x9e,
+    0xfd, 0x93, 0x0, 0x4, 0xaf, 0xff, 0xb5, 0x0,
+    0x1f, 0x3, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x28,
+    0x1d, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x2, 0x7d, 0xff, 0xe8, 0x30,
+    0x0, 0x0, 0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0,
+    0x0, 0x6b, 0xff, 0xf9, 0x40, 0x2, 0x6a, 0xce,
+    0xff, 0xfe, 0xdb, 0x73, 0x0, 0x4, 0x0, 0x8,
+    0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1,
+    0x6c, 0xff, 0xe8, 0x30, 0xc, 0x10, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe8, 0x30, 0x3, 0x8d, 0xff, 0xb6, 0x21, 0x11,
+    0x15, 0xaf, 0xff, 0xb6, 0x21, 0x10, 0x1f, 0x3,
+    0x16, 0xbf, 0xfe, 0x94, 0x0, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x4, 0x0, 0x8, 0x3, 0x8e,
+    0xff, 0xc7, 0x10, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xd7, 0x20, 0xc, 0x10, 0x3, 0x8e, 0xff, 0xc7,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x94, 0x1f, 0x3, 0x16, 0xbf,
+    0xfe, 0x94, 0x0, 0x28, 0x18, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x4, 0x0, 0x8, 0x0, 0x5b, 0xff, 0xfa,
+    0x50, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xa4, 0x0,
+    0xc, 0x10, 0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0,
+    0x0, 0x16, 0xbf, 0xff, 0xa4, 0x0, 0x12, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x48, 0xbf, 0xff, 0xc8,
+    0x54, 0x21, 0x1f, 0x3, 0x16, 0xbf, 0xfe, 0x94,
+    0x0, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x4,
+    0x1, 0x12, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c,
+    0xef, 0xfe, 0x94, 0x0, 0x0, 0x3, 0x7c, 0xed,
+    0x94, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x18, 0x3, 0x4,
+    0xaf, 0xff, 0xb5, 0x0, 0x1f, 0x3, 0x16, 0xbf,
+    0xfe, 0x94, 0x0, 0x28, 0x18, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x4, 0x1, 0x12, 0x0, 0x36, 0xac, 0xef,
+    0xff, 0xfe, 0xc9, 0x62, 0x0, 0x0, 0x0, 0x3,
+    0x8d, 0xfe, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x36,
+    0xac, 0xef, 0xff, 0xfe, 0xc9, 0x62, 0x0, 0x18,
+    0x3, 0x4, 0xaf, 0xff, 0xb5, 0x0, 0x1f, 0x3,
+    0x16, 0xbf, 0xfe, 0x94, 0x0, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50,
+};
+
+/* "0.053 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_5[] = {
+    0x2, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xd, 0x16, 0x1, 0x37,
+    0xac, 0xef, 0xff, 0xfe, 0xca, 0x63, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x2, 0x59,
+    0xbd, 0xef, 0xff, 0xed, 0xb8, 0x52, 0x0, 0x3,
+    0x1, 0x6, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c,
+    0xef, 0xfe, 0x94, 0xd, 0x16, 0x5a, 0xef, 0xfe,
+    0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0,
+    0x0, 0x16, 0xbf, 0xfe, 0xb9, 0x88, 0x88, 0x88,
+    0x88, 0x86, 0x30, 0x0, 0x4, 0x9e, 0xff, 0xec,
+    0x97, 0x77, 0x9c, 0xef, 0xfd, 0x83, 0x40, 0x5,
+    0x2, 0x59, 0xce, 0xff, 0xfe, 0xca, 0x62, 0x0,
+    0x4, 0x0, 0x8, 0x0, 0x5b, 0xff, 0xea, 0x40,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5, 0x0, 0xc,
+    0xc, 0x0, 0x5b, 0xff, 0xea, 0x40, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xa5, 0x0, 0x0, 0x2, 0x8d,
+    0xff, 0xb5, 0x0, 0x1c, 0x8, 0x4, 0x9f, 0xff,
+    0xb6, 0x10, 0x0, 0x0, 0x17, 0xcf, 0xfe, 0x93,
+    0x0, 0x40, 0x5, 0x14, 0x68, 0x75, 0x21, 0x39,
+    0xdf, 0xc7, 0x20, 0x4, 0x0, 0x8, 0x3, 0x8e,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xd7, 0x20, 0xc, 0xd, 0x3, 0x8e, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0x0, 0x4, 0x9f, 0xfe, 0x93, 0x0, 0x11, 0x0,
+    0x21, 0x3, 0x6b, 0xff, 0xf9, 0x40, 0x0, 0x28,
+    0x1d, 0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef,
+    0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef, 0xff, 0xec,
+    0xa6, 0x20, 0x0, 0x2, 0x7d, 0xff, 0xc9, 0x79,
+    0xbd, 0xef, 0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef,
+    0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x27,
+    0xce, 0xff, 0xec, 0x62, 0x0, 0x4, 0x0, 0x8,
+    0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1,
+    0x6c, 0xff, 0xe8, 0x30, 0xc, 0xf, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe8, 0x30, 0x0, 0x6, 0xbf, 0xff, 0xee, 0xef,
+    0xff, 0xff, 0xdb, 0x73, 0x10, 0x1f, 0x4, 0x11,
+    0x23, 0x59, 0xdf, 0xfd, 0x83, 0x28, 0x1d, 0x2,
+    0x7d, 0xff, 0xff, 0xdb, 0x87, 0x79, 0xce, 0xff,
+    0xff, 0xfe, 0xb9, 0x77, 0x8b, 0xdf, 0xff, 0xc6,
+    0x10, 0x2, 0x7d, 0xff, 0xff, 0xdb, 0x87, 0x79,
+    0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77, 0x8b, 0xdf,
+    0xff, 0xc6, 0x10, 0x25, 0x9a, 0x85, 0x21, 0x27,
+    0xcf, 0xe9, 0x40, 0x3, 0x0, 0x8, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe9, 0x30, 0xc, 0x17, 0x4, 0x9f, 0xff, 0xb6,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe9, 0x30,
+    0x0, 0x14, 0x8b, 0xdc, 0xa8, 0x65, 0x56, 0x9c,
+    0xef, 0xfe, 0x94, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xaf, 0xff, 0xff, 0xff, 0xd8, 0x30, 0x0, 0x28,
+    0x1d, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x2, 0x7d, 0xff, 0xe8, 0x30,
+    0x0, 0x0, 0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0,
+    0x0, 0x6b, 0xff, 0xf9, 0x40, 0x2, 0x6a, 0xce,
+    0xff, 0xfe, 0xdb, 0x73, 0x0, 0x4, 0x0, 0x8,
+    0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1,
+    0x6c, 0xff, 0xe8, 0x30, 0xc, 0x8, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe8, 0x30, 0x19, 0xb, 0x17, 0xcf, 0xfe, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x44, 0x55, 0x7a,
+    0xdf, 0xfe, 0xa5, 0x10, 0x0, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x5, 0x0, 0x8, 0x3, 0x8e,
+    0xff, 0xc7, 0x10, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xd7, 0x20, 0xc, 0x8, 0x3, 0x8e, 0xff, 0xc7,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0x19, 0x3, 0x4, 0xaf, 0xff, 0xa5, 0x0, 0x21,
+    0x3, 0x49, 0xef, 0xfb, 0x61, 0x0, 0x28, 0x18,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x5a, 0xff, 0xfa, 0x50, 0x3, 0x0, 0x8, 0x0,
+    0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x16, 0xbf,
+    0xff, 0xa4, 0x0, 0xc, 0x18, 0x0, 0x5b, 0xff,
+    0xfa, 0x50, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xa4,
+    0x0, 0x0, 0x5a, 0xff, 0xea, 0x40, 0x0, 0x0,
+    0x2, 0x7c, 0xff, 0xe8, 0x30, 0x5, 0xae, 0xed,
+    0x94, 0x0, 0x0, 0x0, 0x4, 0xae, 0xff, 0xb5,
+    0x0, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2,
+    0x1, 0x23, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c,
+    0xef, 0xfe, 0x94, 0x0, 0x0, 0x3, 0x7c, 0xed,
+    0x94, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0, 0x0,
+    0x4a, 0xef, 0xfe, 0xb8, 0x77, 0x8a, 0xdf, 0xff,
+    0xd8, 0x20, 0x0, 0x15, 0xbf, 0xff, 0xeb, 0x87,
+    0x77, 0x9b, 0xef, 0xfe, 0xa5, 0x10, 0x0, 0x28,
+    0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x1, 0x22,
+    0x0, 0x36, 0xac, 0xef, 0xff, 0xfe, 0xc9, 0x62,
+    0x0, 0x0, 0x0, 0x3, 0x8d, 0xfe, 0xa5, 0x0,
+    0x0, 0x0, 0x0, 0x36, 0xac, 0xef, 0xff, 0xfe,
+    0xc9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
+    0x9b, 0xde, 0xff, 0xee, 0xcb, 0x84, 0x10, 0x0,
+    0x0, 0x0, 0x13, 0x69, 0xbd, 0xef, 0xff, 0xed,
+    0xb9, 0x63, 0x0, 0x28, 0x18, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50,
+};
+
+/* "0.085 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_6[] = {
+    0x2, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xd, 0x17, 0x1, 0x37,
+    0xac, 0xef, 0xff, 0xfe, 0xca, 0x63, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x36, 0xac, 0xde, 0xff, 0xed,
+    0xb9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x5, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61,
+    0x0, 0x3, 0x1, 0x6, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0xd, 0x17, 0x5a,
+    0xef, 0xfe, 0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94,
+    0x0, 0x0, 0x1, 0x5a, 0xef, 0xfe, 0xb9, 0x77,
+    0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0, 0x0, 0x16,
+    0xbf, 0xfe, 0xb9, 0x88, 0x88, 0x88, 0x88, 0x86,
+    0x30, 0x0, 0x40, 0x5, 0x2, 0x59, 0xce, 0xff,
+    0xfe, 0xca, 0x62, 0x0, 0x3, 0x0, 0x8, 0x0,
+    0x5b, 0xff, 0xea, 0x40, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xa5, 0x0, 0xc, 0x14, 0x0, 0x5b, 0xff,
+    0xea, 0x40, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5,
+    0x0, 0x0, 0x4a, 0xff, 0xfb, 0x60, 0x0, 0x0,
+    0x17, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x2, 0x8d,
+    0xff, 0xb5, 0x0, 0x40, 0x5, 0x14, 0x68, 0x75,
+    0x21, 0x39, 0xdf, 0xc7, 0x20, 0x3, 0x0, 0x8,
+    0x3, 0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0xc, 0x15, 0x3, 0x8e,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xd7, 0x20, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x0,
+    0x0, 0x5, 0xbf, 0xff, 0xa4, 0x0, 0x0, 0x4,
+    0x9f, 0xfe, 0x93, 0x0, 0x11, 0x0, 0x28, 0x1d,
+    0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef, 0xfe,
+    0xda, 0x62, 0x25, 0x9c, 0xef, 0xff, 0xec, 0xa6,
+    0x20, 0x0, 0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd,
+    0xef, 0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef, 0xff,
+    0xec, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x27, 0xce,
+    0xff, 0xec, 0x62, 0x0, 0x3, 0x0, 0x8, 0x4,
+    0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xe8, 0x30, 0xc, 0x17, 0x4, 0x9f, 0xff,
+    0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8,
+    0x30, 0x0, 0x15, 0xbf, 0xff, 0xc7, 0x42, 0x24,
+    0x8c, 0xff, 0xea, 0x40, 0x0, 0x0, 0x6, 0xbf,
+    0xff, 0xee, 0xef, 0xff, 0xff, 0xdb, 0x73, 0x10,
+    0x28, 0x1d, 0x2, 0x7d, 0xff, 0xff, 0xdb, 0x87,
+    0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77, 0x8b,
+    0xdf, 0xff, 0xc6, 0x10, 0x2, 0x7d, 0xff, 0xff,
+    0xdb, 0x87, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9,
+    0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x25, 0x9a,
+    0x85, 0x21, 0x27, 0xcf, 0xe9, 0x40, 0x3, 0x0,
+    0x8, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe9, 0x30, 0xc, 0x18, 0x4,
+    0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xe9, 0x30, 0x0, 0x0, 0x15, 0xbe, 0xff,
+    0xff, 0xff, 0xff, 0xea, 0x41, 0x0, 0x0, 0x0,
+    0x14, 0x8b, 0xdc, 0xa8, 0x65, 0x56, 0x9c, 0xef,
+    0xfe, 0x94, 0x0, 0x28, 0x1d, 0x2, 0x7d, 0xff,
+    0xe8, 0x30, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xb5,
+    0x0, 0x0, 0x0, 0x6b, 0xff, 0xf9, 0x40, 0x2,
+    0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0, 0x27, 0xdf,
+    0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b, 0xff, 0xf9,
+    0x40, 0x2, 0x6a, 0xce, 0xff, 0xfe, 0xdb, 0x73,
+    0x0, 0x4, 0x0, 0x8, 0x4, 0x9f, 0xff, 0xb6,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8, 0x30,
+    0xc, 0x10, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0,
+    0x0, 0x1, 0x6c, 0xff, 0xe8, 0x30, 0x0, 0x26,
+    0xbe, 0xfe, 0xc8, 0x65, 0x56, 0x9c, 0xff, 0xea,
+    0x51, 0x0, 0x21, 0x3, 0x17, 0xcf, 0xfe, 0x94,
+    0x0, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x4,
+    0x0, 0x8, 0x3, 0x8e, 0xff, 0xc7, 0x10, 0x0,
+    0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20, 0xc, 0x10,
+    0x3, 0x8e, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0x3, 0x8d, 0xff, 0xc7,
+    0x20, 0x0, 0x0, 0x3, 0x8d, 0xff, 0xc7, 0x20,
+    0x21, 0x3, 0x4, 0xaf, 0xff, 0xa5, 0x0, 0x28,
+    0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x3, 0x0, 0x8,
+    0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x16,
+    0xbf, 0xff, 0xa4, 0x0, 0xc, 0x18, 0x0, 0x5b,
+    0xff, 0xfa, 0x50, 0x0, 0x0, 0x16, 0xbf, 0xff,
+    0xa4, 0x0, 0x3, 0x8d, 0xff, 0xd7, 0x20, 0x0,
+    0x0, 0x3, 0x8d, 0xff, 0xd7, 0x20, 0x0, 0x5a,
+    0xff, 0xea, 0x40, 0x0, 0x0, 0x2, 0x7c, 0xff,
+    0xe8, 0x30, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x1, 0x23, 0x5a, 0xef, 0xfe, 0xb8, 0x77,
+    0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0, 0x3, 0x7c,
+    0xed, 0x94, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe,
+    0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0,
+    0x3, 0x8d, 0xff, 0xfd, 0xa8, 0x77, 0x8a, 0xdf,
+    0xff, 0xd8, 0x20, 0x0, 0x0, 0x4a, 0xef, 0xfe,
+    0xb8, 0x77, 0x8a, 0xdf, 0xff, 0xd8, 0x20, 0x0,
+    0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x1,
+    0x22, 0x0, 0x36, 0xac, 0xef, 0xff, 0xfe, 0xc9,
+    0x62, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xfe, 0xa5,
+    0x0, 0x0, 0x0, 0x0, 0x36, 0xac, 0xef, 0xff,
+    0xfe, 0xc9, 0x62, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x48, 0xbc, 0xee, 0xff, 0xee, 0xca, 0x84, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x25, 0x9b, 0xde, 0xff,
+    0xee, 0xcb, 0x84, 0x10, 0x28, 0x18, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50,
+};
+
+/* "0.170 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_7[] = {
+    0x2, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xe, 0x15, 0x0, 0x13,
+    0x68, 0xac, 0xd8, 0x30, 0x0, 0x0, 0x0, 0x38,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfb, 0x50, 0x0, 0x0, 0x13, 0x7a, 0xce,
+    0xff, 0xff, 0xec, 0xa6, 0x30, 0x0, 0x3, 0x1,
+    0x6, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c, 0xef,
+    0xfe, 0x94, 0xc, 0x17, 0x0, 0x14, 0x8b, 0xde,
+    0xff, 0xff, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0,
+    0x13, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68,
+    0xbe, 0xff, 0xd7, 0x20, 0x0, 0x5, 0xae, 0xff,
+    0xeb, 0x87, 0x79, 0xce, 0xff, 0xe9, 0x40, 0x40,
+    0x5, 0x2, 0x59, 0xce, 0xff, 0xfe, 0xca, 0x62,
+    0x0, 0x4, 0x0, 0x8, 0x0, 0x5b, 0xff, 0xea,
+    0x40, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5, 0x0,
+    0xc, 0x6, 0x0, 0x28, 0xcd, 0xb9, 0x76, 0x9c,
+    0xff, 0xe9, 0x40, 0x18, 0xc, 0x0, 0x27, 0xdf,
+    0xfc, 0x71, 0x0, 0x0, 0x5b, 0xff, 0xea, 0x40,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5, 0x0, 0x40,
+    0x5, 0x14, 0x68, 0x75, 0x21, 0x39, 0xdf, 0xc7,
+    0x20, 0x4, 0x0, 0x8, 0x3, 0x8e, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0xf, 0x3, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x18,
+    0xc, 0x3, 0x9e, 0xff, 0xb5, 0x10, 0x0, 0x3,
+    0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2, 0x7d,
+    0xff, 0xd7, 0x20, 0x28, 0x1d, 0x2, 0x7d, 0xff,
+    0xc9, 0x79, 0xbd, 0xef, 0xfe, 0xda, 0x62, 0x25,
+    0x9c, 0xef, 0xff, 0xec, 0xa6, 0x20, 0x0, 0x2,
+    0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef, 0xfe, 0xda,
+    0x62, 0x25, 0x9c, 0xef, 0xff, 0xec, 0xa6, 0x20,
+    0x0, 0x0, 0x0, 0x27, 0xce, 0xff, 0xec, 0x62,
+    0x0, 0x4, 0x0, 0x8, 0x4, 0x9f, 0xff, 0xb6,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8, 0x30,
+    0xf, 0x3, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x18,
+    0xc, 0x5a, 0xff, 0xea, 0x40, 0x0, 0x0, 0x4,
+    0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c,
+    0xff, 0xe8, 0x30, 0x28, 0x1d, 0x2, 0x7d, 0xff,
+    0xff, 0xdb, 0x87, 0x79, 0xce, 0xff, 0xff, 0xfe,
+    0xb9, 0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x2,
+    0x7d, 0xff, 0xff, 0xdb, 0x87, 0x79, 0xce, 0xff,
+    0xff, 0xfe, 0xb9, 0x77, 0x8b, 0xdf, 0xff, 0xc6,
+    0x10, 0x25, 0x9a, 0x85, 0x21, 0x27, 0xcf, 0xe9,
+    0x40, 0x4, 0x0, 0x8, 0x4, 0x9f, 0xff, 0xb6,
+    0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe9, 0x30,
+    0xf, 0x3, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x17,
+    0xd, 0x1, 0x6b, 0xff, 0xe9, 0x40, 0x0, 0x0,
+    0x0, 0x49, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x28, 0x1d, 0x2,
+    0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0, 0x27, 0xdf,
+    0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b, 0xff, 0xf9,
+    0x40, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x2, 0x6a, 0xce, 0xff, 0xfe,
+    0xdb, 0x73, 0x0, 0x4, 0x0, 0x8, 0x4, 0x9f,
+    0xff, 0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff,
+    0xe8, 0x30, 0xf, 0x3, 0x16, 0xbf, 0xfe, 0x94,
+    0x0, 0x17, 0xd, 0x27, 0xdf, 0xfd, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xff, 0xfb, 0x60, 0x0,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x83, 0x0, 0x28,
+    0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x4, 0x0, 0x8,
+    0x3, 0x8e, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0xf, 0x3, 0x16, 0xbf,
+    0xfe, 0x94, 0x0, 0x16, 0xe, 0x0, 0x39, 0xef,
+    0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8e,
+    0xff, 0xc7, 0x10, 0x0, 0x0, 0x2, 0x7d, 0xff,
+    0xd7, 0x20, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x5, 0x0, 0x8, 0x0, 0x5b, 0xff, 0xfa, 0x50,
+    0x0, 0x0, 0x16, 0xbf, 0xff, 0xa4, 0x0, 0xf,
+    0x3, 0x16, 0xbf, 0xfe, 0x94, 0x0, 0x16, 0x3,
+    0x5, 0xaf, 0xff, 0xb6, 0x10, 0x1c, 0x8, 0x0,
+    0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x16, 0xbf,
+    0xff, 0xa4, 0x0, 0x28, 0x18, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x5, 0x1, 0xa, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0, 0x3,
+    0x7c, 0xed, 0x94, 0xf, 0x3, 0x16, 0xbf, 0xfe,
+    0x94, 0x0, 0x15, 0x4, 0x0, 0x16, 0xbf, 0xff,
+    0xa5, 0x0, 0x1d, 0x6, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x5, 0x1, 0xa, 0x0, 0x36,
+    0xac, 0xef, 0xff, 0xfe, 0xc9, 0x62, 0x0, 0x0,
+    0x0, 0x3, 0x8d, 0xfe, 0xa5, 0xf, 0x3, 0x16,
+    0xbf, 0xfe, 0x94, 0x0, 0x15, 0x3, 0x2, 0x7d,
+    0xff, 0xe9, 0x40, 0x1d, 0x6, 0x0, 0x36, 0xac,
+    0xef, 0xff, 0xfe, 0xc9, 0x62, 0x0, 0x28, 0x18,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x5a, 0xff, 0xfa, 0x50,
+};
+
+/* "0.350 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_8[] = {
+    0x2, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xd, 0x16, 0x2, 0x59,
+    0xbd, 0xef, 0xff, 0xed, 0xb8, 0x52, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x61, 0x0, 0x0, 0x1, 0x37,
+    0xac, 0xef, 0xff, 0xfe, 0xca, 0x63, 0x0, 0x3,
+    0x1, 0x6, 0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c,
+    0xef, 0xfe, 0x94, 0xc, 0x17, 0x0, 0x49, 0xef,
+    0xfe, 0xc9, 0x77, 0x79, 0xce, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xeb, 0x98, 0x88,
+    0x88, 0x88, 0x88, 0x63, 0x0, 0x0, 0x5, 0xae,
+    0xff, 0xeb, 0x87, 0x79, 0xce, 0xff, 0xe9, 0x40,
+    0x40, 0x5, 0x2, 0x59, 0xce, 0xff, 0xfe, 0xca,
+    0x62, 0x0, 0x4, 0x0, 0x8, 0x0, 0x5b, 0xff,
+    0xea, 0x40, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5,
+    0x0, 0xc, 0xc, 0x4, 0x9f, 0xff, 0xb6, 0x10,
+    0x0, 0x0, 0x17, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x2, 0x8d, 0xff, 0xb5, 0x0, 0x1c, 0x8, 0x0,
+    0x5b, 0xff, 0xea, 0x40, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xa5, 0x0, 0x40, 0x5, 0x14, 0x68, 0x75,
+    0x21, 0x39, 0xdf, 0xc7, 0x20, 0x4, 0x0, 0x8,
+    0x3, 0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0x11, 0x8, 0x6b, 0xff,
+    0xf9, 0x40, 0x0, 0x0, 0x49, 0xff, 0xe9, 0x30,
+    0x1, 0x10, 0x1c, 0x8, 0x3, 0x8e, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0x28, 0x1d, 0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd,
+    0xef, 0xfe, 0xda, 0x62, 0x25, 0x9c, 0xef, 0xff,
+    0xec, 0xa6, 0x20, 0x0, 0x2, 0x7d, 0xff, 0xc9,
+    0x79, 0xbd, 0xef, 0xfe, 0xda, 0x62, 0x25, 0x9c,
+    0xef, 0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0,
+    0x27, 0xce, 0xff, 0xec, 0x62, 0x0, 0x3, 0x0,
+    0x8, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe8, 0x30, 0xf, 0x15, 0x11,
+    0x23, 0x59, 0xdf, 0xfd, 0x83, 0x0, 0x0, 0x0,
+    0x6b, 0xff, 0xfe, 0xee, 0xff, 0xff, 0xfd, 0xb7,
+    0x31, 0x0, 0x0, 0x49, 0xff, 0xfb, 0x60, 0x0,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x83, 0x0, 0x28,
+    0x1d, 0x2, 0x7d, 0xff, 0xff, 0xdb, 0x87, 0x79,
+    0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77, 0x8b, 0xdf,
+    0xff, 0xc6, 0x10, 0x2, 0x7d, 0xff, 0xff, 0xdb,
+    0x87, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77,
+    0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x25, 0x9a, 0x85,
+    0x21, 0x27, 0xcf, 0xe9, 0x40, 0x3, 0x0, 0x8,
+    0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1,
+    0x6c, 0xff, 0xe9, 0x30, 0xe, 0x16, 0x5, 0xaf,
+    0xff, 0xff, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x0,
+    0x14, 0x8b, 0xdc, 0xa8, 0x65, 0x56, 0x9c, 0xef,
+    0xfe, 0x94, 0x0, 0x4, 0x9f, 0xff, 0xb6, 0x0,
+    0x0, 0x0, 0x1, 0x6c, 0xff, 0xe9, 0x30, 0x28,
+    0x1d, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0, 0x0,
+    0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x6b,
+    0xff, 0xf9, 0x40, 0x2, 0x7d, 0xff, 0xe8, 0x30,
+    0x0, 0x0, 0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0,
+    0x0, 0x6b, 0xff, 0xf9, 0x40, 0x2, 0x6a, 0xce,
+    0xff, 0xfe, 0xdb, 0x73, 0x0, 0x4, 0x0, 0x8,
+    0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x1,
+    0x6c, 0xff, 0xe8, 0x30, 0xe, 0x6, 0x1, 0x24,
+    0x45, 0x57, 0xad, 0xff, 0xea, 0x51, 0x0, 0x19,
+    0xb, 0x17, 0xcf, 0xfe, 0x94, 0x0, 0x49, 0xff,
+    0xfb, 0x60, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x83, 0x0, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x4, 0x0, 0x8, 0x3, 0x8e, 0xff, 0xc7, 0x10,
+    0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20, 0x11,
+    0x3, 0x49, 0xef, 0xfb, 0x61, 0x0, 0x19, 0xb,
+    0x4, 0xaf, 0xff, 0xa5, 0x0, 0x38, 0xef, 0xfc,
+    0x71, 0x0, 0x0, 0x0, 0x27, 0xdf, 0xfd, 0x72,
+    0x0, 0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff,
+    0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x3,
+    0x0, 0x8, 0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0,
+    0x0, 0x16, 0xbf, 0xff, 0xa4, 0x0, 0xc, 0x18,
+    0x5, 0xae, 0xed, 0x94, 0x0, 0x0, 0x0, 0x4,
+    0xae, 0xff, 0xb5, 0x0, 0x0, 0x5a, 0xff, 0xea,
+    0x40, 0x0, 0x0, 0x2, 0x7c, 0xff, 0xe8, 0x30,
+    0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x16,
+    0xbf, 0xff, 0xa4, 0x0, 0x28, 0x18, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50, 0x2, 0x1, 0x22, 0x5a, 0xef, 0xfe,
+    0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0, 0x0,
+    0x3, 0x7c, 0xed, 0x94, 0x0, 0x0, 0x15, 0xbf,
+    0xff, 0xeb, 0x87, 0x77, 0x9b, 0xef, 0xfe, 0xa5,
+    0x10, 0x0, 0x0, 0x4a, 0xef, 0xfe, 0xb8, 0x77,
+    0x8a, 0xdf, 0xff, 0xd8, 0x20, 0x0, 0x0, 0x5a,
+    0xef, 0xfe, 0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94,
+    0x28, 0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0,
+    0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x5a, 0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8,
+    0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50, 0x2, 0x1,
+    0x22, 0x0, 0x36, 0xac, 0xef, 0xff, 0xfe, 0xc9,
+    0x62, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xfe, 0xa5,
+    0x0, 0x0, 0x0, 0x13, 0x69, 0xbd, 0xef, 0xff,
+    0xed, 0xb9, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x25, 0x9b, 0xde, 0xff, 0xee, 0xcb, 0x84, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x36, 0xac, 0xef, 0xff,
+    0xfe, 0xc9, 0x62, 0x0, 0x28, 0x18, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50,
+};
+
+/* "0.700 mm³", my_font_roboto_14 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_9[] = {
+    0x2, 0x1, 0x6, 0x1, 0x37, 0xac, 0xef, 0xff,
+    0xfe, 0xca, 0x63, 0x0, 0xc, 0x17, 0x38, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfb, 0x50, 0x0, 0x0, 0x13, 0x7a, 0xce, 0xff,
+    0xff, 0xec, 0xa6, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x7a, 0xce, 0xff, 0xff, 0xec, 0xa6, 0x30,
+    0x0, 0x3, 0x1, 0x6, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0xc, 0x17, 0x13,
+    0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0xbe,
+    0xff, 0xd7, 0x20, 0x0, 0x5, 0xae, 0xff, 0xeb,
+    0x87, 0x79, 0xce, 0xff, 0xe9, 0x40, 0x0, 0x0,
+    0x5, 0xae, 0xff, 0xeb, 0x87, 0x79, 0xce, 0xff,
+    0xe9, 0x40, 0x40, 0x5, 0x2, 0x59, 0xce, 0xff,
+    0xfe, 0xca, 0x62, 0x0, 0x3, 0x0, 0x8, 0x0,
+    0x5b, 0xff, 0xea, 0x40, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xa5, 0x0, 0x10, 0x14, 0x0, 0x27, 0xdf,
+    0xfc, 0x71, 0x0, 0x0, 0x5b, 0xff, 0xea, 0x40,
+    0x0, 0x0, 0x5, 0xbf, 0xff, 0xa5, 0x0, 0x0,
+    0x5b, 0xff, 0xea, 0x40, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xa5, 0x0, 0x40, 0x5, 0x14, 0x68, 0x75,
+    0x21, 0x39, 0xdf, 0xc7, 0x20, 0x3, 0x0, 0x8,
+    0x3, 0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0x10, 0x14, 0x3, 0x9e,
+    0xff, 0xb5, 0x10, 0x0, 0x3, 0x8e, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20,
+    0x3, 0x8e, 0xff, 0xc6, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0x28, 0x1d, 0x2, 0x7d,
+    0xff, 0xc9, 0x79, 0xbd, 0xef, 0xfe, 0xda, 0x62,
+    0x25, 0x9c, 0xef, 0xff, 0xec, 0xa6, 0x20, 0x0,
+    0x2, 0x7d, 0xff, 0xc9, 0x79, 0xbd, 0xef, 0xfe,
+    0xda, 0x62, 0x25, 0x9c, 0xef, 0xff, 0xec, 0xa6,
+    0x20, 0x0, 0x0, 0x0, 0x27, 0xce, 0xff, 0xec,
+    0x62, 0x0, 0x3, 0x0, 0x8, 0x4, 0x9f, 0xff,
+    0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8,
+    0x30, 0x10, 0x14, 0x5a, 0xff, 0xea, 0x40, 0x0,
+    0x0, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe8, 0x30, 0x4, 0x9f, 0xff,
+    0xb6, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xe8,
+    0x30, 0x28, 0x1d, 0x2, 0x7d, 0xff, 0xff, 0xdb,
+    0x87, 0x79, 0xce, 0xff, 0xff, 0xfe, 0xb9, 0x77,
+    0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x2, 0x7d, 0xff,
+    0xff, 0xdb, 0x87, 0x79, 0xce, 0xff, 0xff, 0xfe,
+    0xb9, 0x77, 0x8b, 0xdf, 0xff, 0xc6, 0x10, 0x25,
+    0x9a, 0x85, 0x21, 0x27, 0xcf, 0xe9, 0x40, 0x3,
+    0x0, 0x8, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0,
+    0x0, 0x1, 0x6c, 0xff, 0xe9, 0x30, 0xf, 0x15,
+    0x1, 0x6b, 0xff, 0xe9, 0x40, 0x0, 0x0, 0x0,
+    0x49, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x49, 0xff, 0xfb, 0x60,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0,
+    0x28, 0x1d, 0x2, 0x7d, 0xff, 0xe8, 0x30, 0x0,
+    0x0, 0x27, 0xdf, 0xff, 0xb5, 0x0, 0x0, 0x0,
+    0x6b, 0xff, 0xf9, 0x40, 0x2, 0x7d, 0xff, 0xe8,
+    0x30, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x6b, 0xff, 0xf9, 0x40, 0x2, 0x6a,
+    0xce, 0xff, 0xfe, 0xdb, 0x73, 0x0, 0x3, 0x0,
+    0x8, 0x4, 0x9f, 0xff, 0xb6, 0x0, 0x0, 0x0,
+    0x1, 0x6c, 0xff, 0xe8, 0x30, 0xf, 0x15, 0x27,
+    0xdf, 0xfd, 0x82, 0x0, 0x0, 0x0, 0x0, 0x49,
+    0xff, 0xfb, 0x60, 0x0, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x83, 0x0, 0x49, 0xff, 0xfb, 0x60, 0x0,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x83, 0x0, 0x28,
+    0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x3, 0x0, 0x8,
+    0x3, 0x8e, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xd7, 0x20, 0xe, 0x16, 0x0, 0x39,
+    0xef, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x8e, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x2, 0x7d,
+    0xff, 0xd7, 0x20, 0x3, 0x8e, 0xff, 0xc7, 0x10,
+    0x0, 0x0, 0x2, 0x7d, 0xff, 0xd7, 0x20, 0x28,
+    0x18, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30,
+    0x0, 0x0, 0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0,
+    0x0, 0x5a, 0xff, 0xfa, 0x50, 0x4, 0x0, 0x8,
+    0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x16,
+    0xbf, 0xff, 0xa4, 0x0, 0xe, 0x3, 0x5, 0xaf,
+    0xff, 0xb6, 0x10, 0x14, 0x10, 0x0, 0x5b, 0xff,
+    0xfa, 0x50, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xa4,
+    0x0, 0x0, 0x5b, 0xff, 0xfa, 0x50, 0x0, 0x0,
+    0x16, 0xbf, 0xff, 0xa4, 0x0, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x3, 0x1, 0x10, 0x5a, 0xef,
+    0xfe, 0xb8, 0x77, 0x9c, 0xef, 0xfe, 0x94, 0x0,
+    0x0, 0x3, 0x7c, 0xed, 0x94, 0x0, 0x0, 0x0,
+    0x0, 0x16, 0xbf, 0xff, 0xa5, 0x0, 0x15, 0xe,
+    0x5a, 0xef, 0xfe, 0xb8, 0x77, 0x9c, 0xef, 0xfe,
+    0x94, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xfe, 0xb8,
+    0x77, 0x9c, 0xef, 0xfe, 0x94, 0x28, 0x18, 0x2,
+    0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf,
+    0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa,
+    0x50, 0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0,
+    0x16, 0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a,
+    0xff, 0xfa, 0x50, 0x3, 0x1, 0xf, 0x0, 0x36,
+    0xac, 0xef, 0xff, 0xfe, 0xc9, 0x62, 0x0, 0x0,
+    0x0, 0x3, 0x8d, 0xfe, 0xa5, 0x0, 0x0, 0x0,
+    0x2, 0x7d, 0xff, 0xe9, 0x40, 0x15, 0xe, 0x0,
+    0x36, 0xac, 0xef, 0xff, 0xfe, 0xc9, 0x62, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x36, 0xac, 0xef, 0xff,
+    0xfe, 0xc9, 0x62, 0x0, 0x28, 0x18, 0x2, 0x7d,
+    0xff, 0xd8, 0x30, 0x0, 0x0, 0x16, 0xcf, 0xfe,
+    0x93, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xfa, 0x50,
+    0x2, 0x7d, 0xff, 0xd8, 0x30, 0x0, 0x0, 0x16,
+    0xcf, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x5a, 0xff,
+    0xfa, 0x50,
+};
+
+/* "chip 0402", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_10[] = {
+    0x1, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x4, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0xd, 0x3, 0x2, 0x6c, 0xed, 0x73, 0x0, 0x1b,
+    0x5, 0x13, 0x7a, 0xde, 0xff, 0xed, 0xc9, 0x52,
+    0x0, 0x24, 0x11, 0x14, 0xae, 0xff, 0xc7, 0x20,
+    0x0, 0x0, 0x1, 0x37, 0xad, 0xef, 0xfe, 0xdc,
+    0x95, 0x20, 0x0, 0x0, 0x0, 0x25, 0x9c, 0xde,
+    0xff, 0xed, 0xca, 0x63, 0x0, 0x3, 0x6, 0x3,
+    0x4, 0xaf, 0xfd, 0x72, 0x0, 0xd, 0x3, 0x0,
+    0x36, 0x87, 0x41, 0x0, 0x1a, 0x1c, 0x0, 0x49,
+    0xef, 0xea, 0x74, 0x45, 0x9c, 0xff, 0xc6, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xff,
+    0xc7, 0x20, 0x0, 0x0, 0x49, 0xef, 0xea, 0x74,
+    0x45, 0x9c, 0xff, 0xc6, 0x10, 0x0, 0x38, 0xdf,
+    0xfc, 0x95, 0x44, 0x69, 0xdf, 0xfd, 0x82, 0x0,
+    0x2, 0x1, 0x15, 0x14, 0x8b, 0xde, 0xff, 0xed,
+    0xb8, 0x41, 0x0, 0x4a, 0xff, 0xda, 0x8a, 0xde,
+    0xff, 0xec, 0x84, 0x10, 0x0, 0x2, 0x8d, 0xfe,
+    0x94, 0x0, 0x49, 0xff, 0xdb, 0xac, 0xee, 0xfe,
+    0xdb, 0x73, 0x10, 0x1a, 0x1c, 0x4, 0x9e, 0xfd,
+    0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb, 0x61, 0x0,
+    0x0, 0x0, 0x2, 0x7c, 0xfc, 0xcc, 0xff, 0xc7,
+    0x20, 0x0, 0x4, 0x9e, 0xfd, 0x72, 0x0, 0x0,
+    0x5, 0xaf, 0xfb, 0x61, 0x2, 0x6a, 0xdc, 0x84,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xa5, 0x0, 0x3,
+    0x0, 0x17, 0x1, 0x6b, 0xff, 0xd9, 0x64, 0x46,
+    0xad, 0xff, 0xa5, 0x4, 0xaf, 0xff, 0xeb, 0x75,
+    0x56, 0x9d, 0xff, 0xc7, 0x20, 0x0, 0x28, 0xdf,
+    0xe9, 0x40, 0x4, 0x9f, 0xff, 0xc9, 0x53, 0x34,
+    0x8b, 0xef, 0xd8, 0x30, 0x0, 0x1a, 0x15, 0x5,
+    0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xfd,
+    0x82, 0x0, 0x0, 0x1, 0x6b, 0xfd, 0x83, 0x5a,
+    0xff, 0xc7, 0x20, 0x0, 0x5, 0xbf, 0xfb, 0x50,
+    0x0, 0x0, 0x3, 0x8e, 0xfd, 0x82, 0x0, 0x33,
+    0x3, 0x4a, 0xef, 0xc7, 0x20, 0x0, 0x3, 0x0,
+    0x17, 0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0, 0x14,
+    0x79, 0x74, 0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0,
+    0x27, 0xdf, 0xe9, 0x40, 0x0, 0x28, 0xdf, 0xe9,
+    0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x4,
+    0x9e, 0xfd, 0x72, 0x0, 0x1a, 0x15, 0x16, 0xbf,
+    0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xfe, 0x83,
+    0x0, 0x0, 0x5a, 0xee, 0xa5, 0x0, 0x4a, 0xff,
+    0xc7, 0x20, 0x0, 0x16, 0xbf, 0xfb, 0x50, 0x0,
+    0x0, 0x3, 0x8e, 0xfe, 0x83, 0x0, 0x32, 0x3,
+    0x15, 0xae, 0xfd, 0x94, 0x0, 0x3, 0x0, 0x3,
+    0x28, 0xdf, 0xe9, 0x30, 0x0, 0x6, 0x11, 0x4,
+    0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa,
+    0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f,
+    0xfd, 0x72, 0x0, 0x0, 0x2, 0x7d, 0xfe, 0x94,
+    0x0, 0x1a, 0x1a, 0x5, 0xbf, 0xfb, 0x50, 0x0,
+    0x0, 0x3, 0x8e, 0xfd, 0x72, 0x0, 0x38, 0xdf,
+    0xc6, 0x20, 0x0, 0x4a, 0xff, 0xc7, 0x20, 0x0,
+    0x5, 0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e,
+    0xfd, 0x72, 0x0, 0x0, 0x0, 0x0, 0x38, 0xcf,
+    0xfc, 0x72, 0x2, 0x0, 0x17, 0x16, 0xbf, 0xfa,
+    0x50, 0x0, 0x0, 0x2, 0x46, 0x53, 0x14, 0xaf,
+    0xfd, 0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa, 0x40,
+    0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xfd,
+    0x72, 0x0, 0x0, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+    0x1a, 0x1a, 0x3, 0x9e, 0xfd, 0x72, 0x0, 0x0,
+    0x5, 0xaf, 0xfb, 0x61, 0x5, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x83, 0x3,
+    0x9e, 0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb,
+    0x61, 0x0, 0x0, 0x2, 0x6b, 0xef, 0xd8, 0x41,
+    0x0, 0x2, 0x0, 0x17, 0x1, 0x6c, 0xff, 0xc9,
+    0x64, 0x46, 0x9d, 0xff, 0xa5, 0x14, 0xaf, 0xfd,
+    0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0,
+    0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xff, 0xda,
+    0x75, 0x45, 0x9c, 0xff, 0xd8, 0x30, 0x0, 0x1a,
+    0x1c, 0x0, 0x49, 0xef, 0xea, 0x74, 0x45, 0x9c,
+    0xff, 0xc6, 0x10, 0x1, 0x23, 0x33, 0x33, 0x33,
+    0x33, 0x7b, 0xff, 0xd9, 0x42, 0x10, 0x0, 0x49,
+    0xef, 0xea, 0x74, 0x45, 0x9c, 0xff, 0xc6, 0x10,
+    0x0, 0x14, 0xad, 0xff, 0xd9, 0x53, 0x33, 0x33,
+    0x33, 0x32, 0x10, 0x3, 0x1, 0x15, 0x14, 0x8b,
+    0xde, 0xff, 0xed, 0xb7, 0x30, 0x0, 0x4a, 0xff,
+    0xd7, 0x20, 0x0, 0x2, 0x7c, 0xff, 0xa4, 0x0,
+    0x2, 0x8d, 0xfe, 0x94, 0x0, 0x49, 0xff, 0xeb,
+    0xab, 0xde, 0xfe, 0xdb, 0x73, 0x0, 0x1b, 0x5,
+    0x13, 0x7a, 0xde, 0xff, 0xed, 0xc9, 0x52, 0x0,
+    0x24, 0x12, 0x0, 0x4a, 0xff, 0xc7, 0x20, 0x0,
+    0x0, 0x1, 0x37, 0xad, 0xef, 0xfe, 0xdc, 0x95,
+    0x20, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x60, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0,
+};
+
+/* "SOT-23", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_11[] = {
+    0x2, 0x1, 0x16, 0x14, 0x7a, 0xcd, 0xef, 0xff,
+    0xed, 0xa8, 0x41, 0x0, 0x0, 0x0, 0x2, 0x59,
+    0xbd, 0xef, 0xff, 0xed, 0xb8, 0x42, 0x0, 0x1,
+    0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb5, 0x0, 0x1a, 0xc, 0x25, 0x9c,
+    0xde, 0xff, 0xed, 0xca, 0x63, 0x0, 0x0, 0x0,
+    0x3, 0x6a, 0xce, 0xff, 0xfe, 0xdb, 0x95, 0x20,
+    0x1, 0x0, 0x27, 0x1, 0x5b, 0xff, 0xeb, 0x85,
+    0x55, 0x57, 0xad, 0xff, 0xc7, 0x20, 0x1, 0x5a,
+    0xef, 0xfd, 0xa7, 0x66, 0x68, 0xbd, 0xff, 0xe9,
+    0x40, 0x1, 0x34, 0x44, 0x44, 0x59, 0xdf, 0xfc,
+    0x85, 0x44, 0x44, 0x43, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x38, 0xdf, 0xfc, 0x95, 0x44, 0x69, 0xdf,
+    0xfd, 0x82, 0x0, 0x3, 0x8e, 0xff, 0xc8, 0x54,
+    0x46, 0x9d, 0xff, 0xb6, 0x10, 0x0, 0x2, 0x0,
+    0x14, 0x4, 0x9e, 0xfe, 0x93, 0x0, 0x0, 0x0,
+    0x4, 0x8b, 0xb8, 0x40, 0x17, 0xcf, 0xfc, 0x72,
+    0x0, 0x0, 0x0, 0x2, 0x7d, 0xff, 0xb6, 0x10,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xfb, 0x60, 0x19,
+    0xe, 0x26, 0xad, 0xc8, 0x40, 0x0, 0x0, 0x16,
+    0xbf, 0xfa, 0x50, 0x0, 0x36, 0x87, 0x52, 0x0,
+    0x0, 0x2, 0x7c, 0xff, 0xa4, 0x0, 0x3, 0x0,
+    0x14, 0x0, 0x4a, 0xef, 0xfd, 0xa6, 0x42, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x5a, 0xff, 0xd7, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xe9, 0x40,
+    0x0, 0x0, 0x0, 0x16, 0xcf, 0xfb, 0x60, 0x1d,
+    0x3, 0x4a, 0xef, 0xc7, 0x20, 0x0, 0x23, 0x4,
+    0x1, 0x37, 0xbf, 0xfb, 0x61, 0x0, 0x3, 0x1,
+    0x18, 0x2, 0x48, 0xac, 0xef, 0xff, 0xec, 0xa7,
+    0x41, 0x0, 0x16, 0xbf, 0xfc, 0x61, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x7d, 0xff, 0xa5, 0x0, 0x0,
+    0x0, 0x1, 0x6c, 0xff, 0xb6, 0x0, 0x0, 0x49,
+    0xef, 0xff, 0xff, 0xfd, 0x82, 0x1c, 0x3, 0x15,
+    0xae, 0xfd, 0x94, 0x0, 0x22, 0x4, 0x6b, 0xff,
+    0xff, 0xfe, 0xb6, 0x10, 0x2, 0x3, 0x1b, 0x1,
+    0x25, 0x7a, 0xdf, 0xfd, 0x83, 0x5, 0xaf, 0xfd,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9e, 0xfe,
+    0x94, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0xb6,
+    0x0, 0x0, 0x2, 0x33, 0x33, 0x33, 0x32, 0x10,
+    0x0, 0x0, 0x0, 0x3, 0x8c, 0xff, 0xc7, 0x20,
+    0x22, 0x5, 0x12, 0x33, 0x45, 0x8c, 0xef, 0xc7,
+    0x20, 0x0, 0x2, 0x0, 0x14, 0x26, 0xac, 0xc8,
+    0x40, 0x0, 0x0, 0x0, 0x6, 0xbf, 0xfc, 0x71,
+    0x17, 0xcf, 0xfc, 0x72, 0x0, 0x0, 0x0, 0x2,
+    0x7d, 0xff, 0xb6, 0x10, 0x0, 0x0, 0x0, 0x16,
+    0xcf, 0xfb, 0x60, 0x1a, 0xd, 0x2, 0x6b, 0xef,
+    0xd8, 0x41, 0x0, 0x0, 0x0, 0x0, 0x13, 0x56,
+    0x63, 0x10, 0x0, 0x0, 0x5, 0xaf, 0xfc, 0x61,
+    0x0, 0x2, 0x0, 0x14, 0x3, 0x8d, 0xff, 0xda,
+    0x75, 0x44, 0x56, 0x9c, 0xff, 0xe9, 0x40, 0x1,
+    0x5a, 0xef, 0xfd, 0xa7, 0x65, 0x67, 0xad, 0xff,
+    0xe9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x16, 0xcf,
+    0xfb, 0x60, 0x19, 0xe, 0x1, 0x4a, 0xdf, 0xfd,
+    0x95, 0x33, 0x33, 0x33, 0x33, 0x21, 0x0, 0x4a,
+    0xef, 0xeb, 0x75, 0x44, 0x58, 0xce, 0xfd, 0x83,
+    0x0, 0x3, 0x1, 0xd, 0x14, 0x7a, 0xce, 0xff,
+    0xff, 0xed, 0xb9, 0x63, 0x0, 0x0, 0x0, 0x2,
+    0x58, 0xbd, 0xef, 0xff, 0xed, 0xb8, 0x52, 0x0,
+    0x11, 0x3, 0x1, 0x6c, 0xff, 0xb6, 0x0, 0x19,
+    0xd, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb6, 0x0, 0x1, 0x37, 0xac, 0xee,
+    0xff, 0xed, 0xc9, 0x62, 0x0,
+};
+
+/* "chip 0603", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_12[] = {
+    0x1, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x4, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0xd, 0x3, 0x2, 0x6c, 0xed, 0x73, 0x0, 0x1b,
+    0x5, 0x13, 0x7a, 0xde, 0xff, 0xed, 0xc9, 0x52,
+    0x0, 0x23, 0x12, 0x24, 0x8a, 0xcd, 0xef, 0xb6,
+    0x10, 0x0, 0x0, 0x0, 0x13, 0x7a, 0xde, 0xff,
+    0xed, 0xc9, 0x52, 0x0, 0x0, 0x0, 0x3, 0x6a,
+    0xce, 0xff, 0xfe, 0xdb, 0x95, 0x20, 0x3, 0x6,
+    0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0, 0xd, 0x3,
+    0x0, 0x36, 0x87, 0x41, 0x0, 0x1a, 0x1c, 0x0,
+    0x49, 0xef, 0xea, 0x74, 0x45, 0x9c, 0xff, 0xc6,
+    0x10, 0x0, 0x0, 0x15, 0xae, 0xff, 0xda, 0x76,
+    0x53, 0x10, 0x0, 0x0, 0x0, 0x49, 0xef, 0xea,
+    0x74, 0x45, 0x9c, 0xff, 0xc6, 0x10, 0x0, 0x38,
+    0xef, 0xfc, 0x85, 0x44, 0x69, 0xdf, 0xfb, 0x61,
+    0x0, 0x3, 0x1, 0x15, 0x14, 0x8b, 0xde, 0xff,
+    0xed, 0xb8, 0x41, 0x0, 0x4a, 0xff, 0xda, 0x8a,
+    0xde, 0xff, 0xec, 0x84, 0x10, 0x0, 0x2, 0x8d,
+    0xfe, 0x94, 0x0, 0x49, 0xff, 0xdb, 0xac, 0xee,
+    0xfe, 0xdb, 0x73, 0x10, 0x1a, 0xa, 0x4, 0x9e,
+    0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb, 0x61,
+    0x0, 0x3, 0x8e, 0xfd, 0x94, 0x28, 0xe, 0x4,
+    0x9e, 0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb,
+    0x61, 0x0, 0x36, 0x87, 0x52, 0x0, 0x0, 0x2,
+    0x7c, 0xff, 0xa4, 0x0, 0x3, 0x0, 0x17, 0x1,
+    0x6b, 0xff, 0xd9, 0x64, 0x46, 0xad, 0xff, 0xa5,
+    0x4, 0xaf, 0xff, 0xeb, 0x75, 0x56, 0x9d, 0xff,
+    0xc7, 0x20, 0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4,
+    0x9f, 0xff, 0xc9, 0x53, 0x34, 0x8b, 0xef, 0xd8,
+    0x30, 0x0, 0x1a, 0x15, 0x5, 0xbf, 0xfb, 0x50,
+    0x0, 0x0, 0x3, 0x8e, 0xfd, 0x82, 0x0, 0x27,
+    0xdf, 0xfc, 0xbb, 0xdf, 0xff, 0xec, 0x95, 0x10,
+    0x0, 0x5, 0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3,
+    0x8e, 0xfd, 0x82, 0x0, 0x32, 0x4, 0x1, 0x37,
+    0xbf, 0xfb, 0x61, 0x0, 0x2, 0x0, 0x17, 0x16,
+    0xbf, 0xfa, 0x50, 0x0, 0x0, 0x14, 0x79, 0x74,
+    0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27, 0xdf,
+    0xe9, 0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4,
+    0x9f, 0xfd, 0x72, 0x0, 0x0, 0x4, 0x9e, 0xfd,
+    0x72, 0x0, 0x1a, 0x1b, 0x16, 0xbf, 0xfb, 0x50,
+    0x0, 0x0, 0x3, 0x8e, 0xfe, 0x83, 0x0, 0x49,
+    0xff, 0xfe, 0xb7, 0x44, 0x47, 0xbe, 0xff, 0xb5,
+    0x10, 0x16, 0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3,
+    0x8e, 0xfe, 0x83, 0x0, 0x0, 0x0, 0x6, 0xbf,
+    0xff, 0xff, 0xeb, 0x61, 0x0, 0x3, 0x0, 0x3,
+    0x28, 0xdf, 0xe9, 0x30, 0x0, 0x6, 0x11, 0x4,
+    0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa,
+    0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f,
+    0xfd, 0x72, 0x0, 0x0, 0x2, 0x7d, 0xfe, 0x94,
+    0x0, 0x1a, 0x1c, 0x5, 0xbf, 0xfb, 0x50, 0x0,
+    0x0, 0x3, 0x8e, 0xfd, 0x72, 0x0, 0x49, 0xff,
+    0xc7, 0x20, 0x0, 0x0, 0x28, 0xdf, 0xe9, 0x40,
+    0x5, 0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e,
+    0xfd, 0x72, 0x0, 0x0, 0x0, 0x1, 0x23, 0x34,
+    0x58, 0xce, 0xfc, 0x72, 0x0, 0x2, 0x0, 0x17,
+    0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0, 0x2, 0x46,
+    0x53, 0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27,
+    0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x4, 0x9f,
+    0xfd, 0x72, 0x0, 0x1a, 0x1c, 0x3, 0x9e, 0xfd,
+    0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb, 0x61, 0x0,
+    0x27, 0xdf, 0xe9, 0x30, 0x0, 0x0, 0x28, 0xdf,
+    0xe9, 0x30, 0x3, 0x9e, 0xfd, 0x72, 0x0, 0x0,
+    0x5, 0xaf, 0xfb, 0x61, 0x1, 0x35, 0x66, 0x31,
+    0x0, 0x0, 0x0, 0x5a, 0xff, 0xc6, 0x10, 0x2,
+    0x0, 0x17, 0x1, 0x6c, 0xff, 0xc9, 0x64, 0x46,
+    0x9d, 0xff, 0xa5, 0x14, 0xaf, 0xfd, 0x72, 0x0,
+    0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf,
+    0xe9, 0x40, 0x4, 0x9f, 0xff, 0xda, 0x75, 0x45,
+    0x9c, 0xff, 0xd8, 0x30, 0x0, 0x1a, 0x1c, 0x0,
+    0x49, 0xef, 0xea, 0x74, 0x45, 0x9c, 0xff, 0xc6,
+    0x10, 0x0, 0x2, 0x7c, 0xff, 0xc9, 0x54, 0x57,
+    0xbe, 0xfe, 0x94, 0x0, 0x0, 0x49, 0xef, 0xea,
+    0x74, 0x45, 0x9c, 0xff, 0xc6, 0x10, 0x0, 0x4a,
+    0xef, 0xeb, 0x75, 0x44, 0x58, 0xce, 0xfd, 0x83,
+    0x0, 0x2, 0x1, 0x15, 0x14, 0x8b, 0xde, 0xff,
+    0xed, 0xb7, 0x30, 0x0, 0x4a, 0xff, 0xd7, 0x20,
+    0x0, 0x2, 0x7c, 0xff, 0xa4, 0x0, 0x2, 0x8d,
+    0xfe, 0x94, 0x0, 0x49, 0xff, 0xeb, 0xab, 0xde,
+    0xfe, 0xdb, 0x73, 0x0, 0x1b, 0x1a, 0x13, 0x7a,
+    0xde, 0xff, 0xed, 0xc9, 0x52, 0x0, 0x0, 0x0,
+    0x0, 0x14, 0x8b, 0xde, 0xff, 0xec, 0xa6, 0x31,
+    0x0, 0x0, 0x0, 0x13, 0x7a, 0xde, 0xff, 0xed,
+    0xc9, 0x52, 0x0, 0x0, 0x0, 0x13, 0x7a, 0xce,
+    0xef, 0xfe, 0xdc, 0x96, 0x20, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10, 0x3,
+    0x4, 0x9f, 0xfd, 0x72, 0x0,
+};
+
+/* "chip 0805", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_13[] = {
+    0x1, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x3, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0xd, 0x3, 0x2, 0x6c, 0xed, 0x73, 0x0, 0x1b,
+    0x1b, 0x13, 0x7a, 0xde, 0xff, 0xed, 0xc9, 0x52,
+    0x0, 0x0, 0x0, 0x1, 0x48, 0xbd, 0xef, 0xfe,
+    0xdc, 0x95, 0x20, 0x0, 0x0, 0x0, 0x13, 0x7a,
+    0xde, 0xff, 0xed, 0xc9, 0x52, 0x0, 0x0, 0x0,
+    0x3, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x61, 0x0, 0x3, 0x6, 0x3, 0x4, 0xaf, 0xfd,
+    0x72, 0x0, 0xd, 0x3, 0x0, 0x36, 0x87, 0x41,
+    0x0, 0x1a, 0x1c, 0x0, 0x49, 0xef, 0xea, 0x74,
+    0x45, 0x9c, 0xff, 0xc6, 0x10, 0x0, 0x4, 0xae,
+    0xfe, 0xb7, 0x44, 0x69, 0xdf, 0xfc, 0x72, 0x0,
+    0x0, 0x49, 0xef, 0xea, 0x74, 0x45, 0x9c, 0xff,
+    0xc6, 0x10, 0x0, 0x0, 0x5a, 0xff, 0xc8, 0x55,
+    0x55, 0x55, 0x55, 0x32, 0x0, 0x2, 0x1, 0x15,
+    0x14, 0x8b, 0xde, 0xff, 0xed, 0xb8, 0x41, 0x0,
+    0x4a, 0xff, 0xda, 0x8a, 0xde, 0xff, 0xec, 0x84,
+    0x10, 0x0, 0x2, 0x8d, 0xfe, 0x94, 0x0, 0x49,
+    0xff, 0xdb, 0xac, 0xee, 0xfe, 0xdb, 0x73, 0x10,
+    0x1a, 0x18, 0x4, 0x9e, 0xfd, 0x72, 0x0, 0x0,
+    0x5, 0xaf, 0xfb, 0x61, 0x0, 0x27, 0xdf, 0xf9,
+    0x40, 0x0, 0x1, 0x7c, 0xff, 0xa4, 0x0, 0x4,
+    0x9e, 0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb,
+    0x61, 0x0, 0x1, 0x7c, 0xfd, 0x83, 0x2, 0x0,
+    0x17, 0x1, 0x6b, 0xff, 0xd9, 0x64, 0x46, 0xad,
+    0xff, 0xa5, 0x4, 0xaf, 0xff, 0xeb, 0x75, 0x56,
+    0x9d, 0xff, 0xc7, 0x20, 0x0, 0x28, 0xdf, 0xe9,
+    0x40, 0x4, 0x9f, 0xff, 0xc9, 0x53, 0x34, 0x8b,
+    0xef, 0xd8, 0x30, 0x0, 0x1a, 0x1b, 0x5, 0xbf,
+    0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xfd, 0x82,
+    0x0, 0x4, 0xae, 0xfd, 0x84, 0x11, 0x26, 0xbe,
+    0xfc, 0x72, 0x0, 0x5, 0xbf, 0xfb, 0x50, 0x0,
+    0x0, 0x3, 0x8e, 0xfd, 0x82, 0x0, 0x3, 0x8e,
+    0xff, 0xed, 0xef, 0xff, 0xec, 0x94, 0x10, 0x2,
+    0x0, 0x17, 0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0,
+    0x14, 0x79, 0x74, 0x14, 0xaf, 0xfd, 0x72, 0x0,
+    0x0, 0x27, 0xdf, 0xe9, 0x40, 0x0, 0x28, 0xdf,
+    0xe9, 0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0,
+    0x4, 0x9e, 0xfd, 0x72, 0x0, 0x1a, 0x1c, 0x16,
+    0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xfe,
+    0x83, 0x0, 0x0, 0x15, 0xae, 0xff, 0xff, 0xff,
+    0xfc, 0x72, 0x0, 0x0, 0x16, 0xbf, 0xfb, 0x50,
+    0x0, 0x0, 0x3, 0x8e, 0xfe, 0x83, 0x0, 0x2,
+    0x58, 0xa9, 0x85, 0x44, 0x57, 0xbe, 0xff, 0xb5,
+    0x10, 0x4, 0x0, 0x3, 0x28, 0xdf, 0xe9, 0x30,
+    0x0, 0x6, 0x11, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf,
+    0xe9, 0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0,
+    0x2, 0x7d, 0xfe, 0x94, 0x0, 0x1a, 0x15, 0x5,
+    0xbf, 0xfb, 0x50, 0x0, 0x0, 0x3, 0x8e, 0xfd,
+    0x72, 0x0, 0x15, 0xbe, 0xfc, 0x95, 0x44, 0x57,
+    0xbe, 0xfd, 0x83, 0x0, 0x5, 0xbf, 0xfb, 0x50,
+    0x0, 0x0, 0x3, 0x8e, 0xfd, 0x72, 0x0, 0x33,
+    0x3, 0x2, 0x7d, 0xff, 0x94, 0x0, 0x2, 0x0,
+    0x17, 0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0, 0x2,
+    0x46, 0x53, 0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0,
+    0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf, 0xe9,
+    0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x4,
+    0x9f, 0xfd, 0x72, 0x0, 0x1a, 0x1c, 0x3, 0x9e,
+    0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb, 0x61,
+    0x0, 0x5a, 0xff, 0xb6, 0x10, 0x0, 0x0, 0x49,
+    0xef, 0xd7, 0x20, 0x3, 0x9e, 0xfd, 0x72, 0x0,
+    0x0, 0x5, 0xaf, 0xfb, 0x61, 0x0, 0x14, 0x79,
+    0x74, 0x10, 0x0, 0x0, 0x27, 0xdf, 0xf9, 0x40,
+    0x2, 0x0, 0x17, 0x1, 0x6c, 0xff, 0xc9, 0x64,
+    0x46, 0x9d, 0xff, 0xa5, 0x14, 0xaf, 0xfd, 0x72,
+    0x0, 0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28,
+    0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xff, 0xda, 0x75,
+    0x45, 0x9c, 0xff, 0xd8, 0x30, 0x0, 0x1a, 0x1c,
+    0x0, 0x49, 0xef, 0xea, 0x74, 0x45, 0x9c, 0xff,
+    0xc6, 0x10, 0x0, 0x28, 0xdf, 0xfc, 0x96, 0x44,
+    0x57, 0xbe, 0xff, 0xa5, 0x0, 0x0, 0x49, 0xef,
+    0xea, 0x74, 0x45, 0x9c, 0xff, 0xc6, 0x10, 0x0,
+    0x4, 0x9e, 0xfe, 0xb7, 0x54, 0x57, 0xbe, 0xfe,
+    0xa5, 0x0, 0x2, 0x1, 0x15, 0x14, 0x8b, 0xde,
+    0xff, 0xed, 0xb7, 0x30, 0x0, 0x4a, 0xff, 0xd7,
+    0x20, 0x0, 0x2, 0x7c, 0xff, 0xa4, 0x0, 0x2,
+    0x8d, 0xfe, 0x94, 0x0, 0x49, 0xff, 0xeb, 0xab,
+    0xde, 0xfe, 0xdb, 0x73, 0x0, 0x1b, 0x1a, 0x13,
+    0x7a, 0xde, 0xff, 0xed, 0xc9, 0x52, 0x0, 0x0,
+    0x0, 0x2, 0x69, 0xcd, 0xef, 0xff, 0xec, 0xa7,
+    0x41, 0x0, 0x0, 0x0, 0x13, 0x7a, 0xde, 0xff,
+    0xed, 0xc9, 0x52, 0x0, 0x0, 0x0, 0x0, 0x36,
+    0xac, 0xef, 0xff, 0xec, 0xa7, 0x31, 0x1, 0x10,
+    0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10,
+    0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1, 0x10,
+    0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+};
+
+/* "chip 1206", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_14[] = {
+    0x1, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x5, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0xd, 0x3, 0x2, 0x6c, 0xed, 0x73, 0x0, 0x1b,
+    0x4, 0x0, 0x12, 0x46, 0x8a, 0xcb, 0x72, 0x22,
+    0xc, 0x25, 0x9c, 0xde, 0xff, 0xed, 0xca, 0x63,
+    0x0, 0x0, 0x0, 0x1, 0x37, 0xad, 0xef, 0xfe,
+    0xdc, 0x95, 0x20, 0x31, 0x4, 0x24, 0x8a, 0xcd,
+    0xef, 0xb6, 0x10, 0x3, 0x6, 0x3, 0x4, 0xaf,
+    0xfd, 0x72, 0x0, 0xd, 0x3, 0x0, 0x36, 0x87,
+    0x41, 0x0, 0x1a, 0x1b, 0x0, 0x49, 0xef, 0xff,
+    0xff, 0xff, 0xd8, 0x20, 0x0, 0x0, 0x0, 0x38,
+    0xdf, 0xfc, 0x95, 0x44, 0x69, 0xdf, 0xfd, 0x82,
+    0x0, 0x0, 0x49, 0xef, 0xea, 0x74, 0x45, 0x9c,
+    0xff, 0xc6, 0x10, 0x0, 0x0, 0x15, 0xae, 0xff,
+    0xda, 0x76, 0x53, 0x10, 0x0, 0x2, 0x1, 0x15,
+    0x14, 0x8b, 0xde, 0xff, 0xed, 0xb8, 0x41, 0x0,
+    0x4a, 0xff, 0xda, 0x8a, 0xde, 0xff, 0xec, 0x84,
+    0x10, 0x0, 0x2, 0x8d, 0xfe, 0x94, 0x0, 0x49,
+    0xff, 0xdb, 0xac, 0xee, 0xfe, 0xdb, 0x73, 0x10,
+    0x1a, 0x18, 0x0, 0x24, 0x53, 0x20, 0x49, 0xef,
+    0xd8, 0x20, 0x0, 0x0, 0x2, 0x6a, 0xdc, 0x84,
+    0x0, 0x0, 0x1, 0x6b, 0xff, 0xa5, 0x0, 0x4,
+    0x9e, 0xfd, 0x72, 0x0, 0x0, 0x5, 0xaf, 0xfb,
+    0x61, 0x0, 0x3, 0x8e, 0xfd, 0x94, 0x3, 0x0,
+    0x17, 0x1, 0x6b, 0xff, 0xd9, 0x64, 0x46, 0xad,
+    0xff, 0xa5, 0x4, 0xaf, 0xff, 0xeb, 0x75, 0x56,
+    0x9d, 0xff, 0xc7, 0x20, 0x0, 0x28, 0xdf, 0xe9,
+    0x40, 0x4, 0x9f, 0xff, 0xc9, 0x53, 0x34, 0x8b,
+    0xef, 0xd8, 0x30, 0x0, 0x1c, 0x3, 0x0, 0x49,
+    0xef, 0xd8, 0x20, 0x25, 0x10, 0x4a, 0xef, 0xc7,
+    0x20, 0x0, 0x5b, 0xff, 0xb5, 0x0, 0x0, 0x0,
+    0x38, 0xef, 0xd8, 0x20, 0x2, 0x7d, 0xff, 0xcb,
+    0xbd, 0xff, 0xfe, 0xc9, 0x51, 0x3, 0x0, 0x17,
+    0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0, 0x14, 0x79,
+    0x74, 0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27,
+    0xdf, 0xe9, 0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x4, 0x9e,
+    0xfd, 0x72, 0x0, 0x1c, 0x3, 0x0, 0x49, 0xef,
+    0xd8, 0x20, 0x24, 0x12, 0x15, 0xae, 0xfd, 0x94,
+    0x0, 0x0, 0x16, 0xbf, 0xfb, 0x50, 0x0, 0x0,
+    0x3, 0x8e, 0xfe, 0x83, 0x0, 0x49, 0xff, 0xfe,
+    0xb7, 0x44, 0x47, 0xbe, 0xff, 0xb5, 0x10, 0x4,
+    0x0, 0x3, 0x28, 0xdf, 0xe9, 0x30, 0x0, 0x6,
+    0x11, 0x4, 0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27,
+    0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x2, 0x7d,
+    0xfe, 0x94, 0x0, 0x1c, 0x3, 0x0, 0x49, 0xef,
+    0xd8, 0x20, 0x23, 0x13, 0x3, 0x8c, 0xff, 0xc7,
+    0x20, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x38, 0xef, 0xd7, 0x20, 0x4, 0x9f,
+    0xfc, 0x72, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0x94,
+    0x0, 0x3, 0x0, 0x17, 0x16, 0xbf, 0xfa, 0x50,
+    0x0, 0x0, 0x2, 0x46, 0x53, 0x14, 0xaf, 0xfd,
+    0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0,
+    0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xfd, 0x72,
+    0x0, 0x0, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1c,
+    0x3, 0x0, 0x49, 0xef, 0xd8, 0x20, 0x22, 0x14,
+    0x2, 0x6b, 0xef, 0xd8, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x9e, 0xfd, 0x72, 0x0, 0x0, 0x5,
+    0xaf, 0xfb, 0x61, 0x0, 0x27, 0xdf, 0xe9, 0x30,
+    0x0, 0x0, 0x28, 0xdf, 0xe9, 0x30, 0x2, 0x0,
+    0x17, 0x1, 0x6c, 0xff, 0xc9, 0x64, 0x46, 0x9d,
+    0xff, 0xa5, 0x14, 0xaf, 0xfd, 0x72, 0x0, 0x0,
+    0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf, 0xe9,
+    0x40, 0x4, 0x9f, 0xff, 0xda, 0x75, 0x45, 0x9c,
+    0xff, 0xd8, 0x30, 0x0, 0x1c, 0x1a, 0x0, 0x49,
+    0xef, 0xd8, 0x20, 0x0, 0x0, 0x0, 0x14, 0xad,
+    0xff, 0xd9, 0x53, 0x33, 0x33, 0x33, 0x32, 0x10,
+    0x0, 0x49, 0xef, 0xea, 0x74, 0x45, 0x9c, 0xff,
+    0xc6, 0x10, 0x0, 0x2, 0x7c, 0xff, 0xc9, 0x54,
+    0x57, 0xbe, 0xfe, 0x94, 0x0, 0x2, 0x1, 0x15,
+    0x14, 0x8b, 0xde, 0xff, 0xed, 0xb7, 0x30, 0x0,
+    0x4a, 0xff, 0xd7, 0x20, 0x0, 0x2, 0x7c, 0xff,
+    0xa4, 0x0, 0x2, 0x8d, 0xfe, 0x94, 0x0, 0x49,
+    0xff, 0xeb, 0xab, 0xde, 0xfe, 0xdb, 0x73, 0x0,
+    0x1c, 0x19, 0x0, 0x49, 0xef, 0xd8, 0x20, 0x0,
+    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x60, 0x0, 0x1, 0x37, 0xad,
+    0xef, 0xfe, 0xdc, 0x95, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x48, 0xbd, 0xef, 0xfe, 0xca, 0x63, 0x10,
+    0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+    0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+    0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+};
+
+/* "chip 2512", my_font_roboto_12 */
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_15[] = {
+    0x1, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0x4, 0x6, 0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0,
+    0xd, 0x3, 0x2, 0x6c, 0xed, 0x73, 0x0, 0x1b,
+    0x12, 0x25, 0x9c, 0xde, 0xff, 0xed, 0xca, 0x63,
+    0x0, 0x0, 0x0, 0x3, 0x9e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0x61, 0x0, 0x0, 0x0, 0x12,
+    0x46, 0x8a, 0xcb, 0x72, 0x30, 0x5, 0x25, 0x9c,
+    0xde, 0xff, 0xed, 0xca, 0x63, 0x0, 0x3, 0x6,
+    0x3, 0x4, 0xaf, 0xfd, 0x72, 0x0, 0xd, 0x3,
+    0x0, 0x36, 0x87, 0x41, 0x0, 0x1a, 0x1c, 0x3,
+    0x8d, 0xff, 0xc9, 0x54, 0x46, 0x9d, 0xff, 0xd8,
+    0x20, 0x0, 0x0, 0x5a, 0xff, 0xc8, 0x55, 0x55,
+    0x55, 0x55, 0x32, 0x0, 0x0, 0x49, 0xef, 0xff,
+    0xff, 0xff, 0xd8, 0x20, 0x0, 0x0, 0x0, 0x38,
+    0xdf, 0xfc, 0x95, 0x44, 0x69, 0xdf, 0xfd, 0x82,
+    0x0, 0x3, 0x1, 0x15, 0x14, 0x8b, 0xde, 0xff,
+    0xed, 0xb8, 0x41, 0x0, 0x4a, 0xff, 0xda, 0x8a,
+    0xde, 0xff, 0xec, 0x84, 0x10, 0x0, 0x2, 0x8d,
+    0xfe, 0x94, 0x0, 0x49, 0xff, 0xdb, 0xac, 0xee,
+    0xfe, 0xdb, 0x73, 0x10, 0x1a, 0xa, 0x26, 0xad,
+    0xc8, 0x40, 0x0, 0x0, 0x16, 0xbf, 0xfa, 0x50,
+    0x0, 0x1, 0x7c, 0xfd, 0x83, 0x28, 0xe, 0x0,
+    0x24, 0x53, 0x20, 0x49, 0xef, 0xd8, 0x20, 0x0,
+    0x0, 0x2, 0x6a, 0xdc, 0x84, 0x0, 0x0, 0x1,
+    0x6b, 0xff, 0xa5, 0x0, 0x4, 0x0, 0x17, 0x1,
+    0x6b, 0xff, 0xd9, 0x64, 0x46, 0xad, 0xff, 0xa5,
+    0x4, 0xaf, 0xff, 0xeb, 0x75, 0x56, 0x9d, 0xff,
+    0xc7, 0x20, 0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4,
+    0x9f, 0xff, 0xc9, 0x53, 0x34, 0x8b, 0xef, 0xd8,
+    0x30, 0x0, 0x1e, 0x9, 0x4a, 0xef, 0xc7, 0x20,
+    0x0, 0x3, 0x8e, 0xff, 0xed, 0xef, 0xff, 0xec,
+    0x94, 0x10, 0x2a, 0x3, 0x0, 0x49, 0xef, 0xd8,
+    0x20, 0x33, 0x3, 0x4a, 0xef, 0xc7, 0x20, 0x0,
+    0x3, 0x0, 0x17, 0x16, 0xbf, 0xfa, 0x50, 0x0,
+    0x0, 0x14, 0x79, 0x74, 0x14, 0xaf, 0xfd, 0x72,
+    0x0, 0x0, 0x27, 0xdf, 0xe9, 0x40, 0x0, 0x28,
+    0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0,
+    0x0, 0x4, 0x9e, 0xfd, 0x72, 0x0, 0x1d, 0x10,
+    0x15, 0xae, 0xfd, 0x94, 0x0, 0x0, 0x0, 0x25,
+    0x8a, 0x98, 0x54, 0x45, 0x7b, 0xef, 0xfb, 0x51,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xfd, 0x82,
+    0x32, 0x3, 0x15, 0xae, 0xfd, 0x94, 0x0, 0x5,
+    0x0, 0x3, 0x28, 0xdf, 0xe9, 0x30, 0x0, 0x6,
+    0x11, 0x4, 0xaf, 0xfd, 0x72, 0x0, 0x0, 0x27,
+    0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf, 0xe9, 0x40,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0, 0x2, 0x7d,
+    0xfe, 0x94, 0x0, 0x1c, 0x3, 0x3, 0x8c, 0xff,
+    0xc7, 0x20, 0x25, 0x8, 0x2, 0x7d, 0xff, 0x94,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xfd, 0x82,
+    0x31, 0x3, 0x3, 0x8c, 0xff, 0xc7, 0x20, 0x3,
+    0x0, 0x17, 0x16, 0xbf, 0xfa, 0x50, 0x0, 0x0,
+    0x2, 0x46, 0x53, 0x14, 0xaf, 0xfd, 0x72, 0x0,
+    0x0, 0x27, 0xcf, 0xfa, 0x40, 0x0, 0x28, 0xdf,
+    0xe9, 0x40, 0x4, 0x9f, 0xfd, 0x72, 0x0, 0x0,
+    0x4, 0x9f, 0xfd, 0x72, 0x0, 0x1b, 0x12, 0x2,
+    0x6b, 0xef, 0xd8, 0x41, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x47, 0x97, 0x41, 0x0, 0x0, 0x2, 0x7d,
+    0xff, 0x94, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9e,
+    0xfd, 0x82, 0x30, 0x4, 0x2, 0x6b, 0xef, 0xd8,
+    0x41, 0x0, 0x2, 0x0, 0x17, 0x1, 0x6c, 0xff,
+    0xc9, 0x64, 0x46, 0x9d, 0xff, 0xa5, 0x14, 0xaf,
+    0xfd, 0x72, 0x0, 0x0, 0x27, 0xcf, 0xfa, 0x40,
+    0x0, 0x28, 0xdf, 0xe9, 0x40, 0x4, 0x9f, 0xff,
+    0xda, 0x75, 0x45, 0x9c, 0xff, 0xd8, 0x30, 0x0,
+    0x1a, 0x1c, 0x1, 0x4a, 0xdf, 0xfd, 0x95, 0x33,
+    0x33, 0x33, 0x33, 0x21, 0x0, 0x4, 0x9e, 0xfe,
+    0xb7, 0x54, 0x57, 0xbe, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x49, 0xef, 0xd8, 0x20, 0x0,
+    0x0, 0x0, 0x14, 0xad, 0xff, 0xd9, 0x53, 0x33,
+    0x33, 0x33, 0x32, 0x10, 0x3, 0x1, 0x15, 0x14,
+    0x8b, 0xde, 0xff, 0xed, 0xb7, 0x30, 0x0, 0x4a,
+    0xff, 0xd7, 0x20, 0x0, 0x2, 0x7c, 0xff, 0xa4,
+    0x0, 0x2, 0x8d, 0xfe, 0x94, 0x0, 0x49, 0xff,
+    0xeb, 0xab, 0xde, 0xfe, 0xdb, 0x73, 0x0, 0x1a,
+    0xd, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xb6, 0x0, 0x0, 0x3, 0x6a, 0xce,
+    0xff, 0xfe, 0xca, 0x73, 0x10, 0x2a, 0xc, 0x0,
+    0x49, 0xef, 0xd8, 0x20, 0x0, 0x0, 0x0, 0x5b,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x60, 0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72,
+    0x0, 0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72,
+    0x0, 0x1, 0x10, 0x3, 0x4, 0x9f, 0xfd, 0x72,
+    0x0,
+};
+
+#endif
+
+const text_sprite_t text_sprites[] = {
+#if TEXT_SPRITES
+    { .font = &my_font_roboto_14, .text = "Syringe dia", .ofs_x = 0, .ofs_y = 2, .width = 72, .height = 14, .data = sprite_0 },
+    { .font = &my_font_roboto_14, .text = "Viscosity", .ofs_x = -1, .ofs_y = 2, .width = 59, .height = 14, .data = sprite_1 },
+    { .font = &my_font_roboto_14, .text = "Flux part", .ofs_x = 0, .ofs_y = 2, .width = 57, .height = 14, .data = sprite_2 },
+    { .font = &my_font_roboto_14, .text = "Fast move", .ofs_x = 0, .ofs_y = 2, .width = 66, .height = 11, .data = sprite_3 },
+    { .font = &my_font_roboto_14, .text = "0.041 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_4 },
+    { .font = &my_font_roboto_14, .text = "0.053 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_5 },
+    { .font = &my_font_roboto_14, .text = "0.085 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_6 },
+    { .font = &my_font_roboto_14, .text = "0.170 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_7 },
+    { .font = &my_font_roboto_14, .text = "0.350 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_8 },
+    { .font = &my_font_roboto_14, .text = "0.700 mm³", .ofs_x = 0, .ofs_y = 2, .width = 69, .height = 11, .data = sprite_9 },
+    { .font = &my_font_roboto_12, .text = "chip 0402", .ofs_x = 0, .ofs_y = 2, .width = 54, .height = 13, .data = sprite_10 },
+    { .font = &my_font_roboto_12, .text = "SOT-23", .ofs_x = 0, .ofs_y = 3, .width = 39, .height = 9, .data = sprite_11 },
+    { .font = &my_font_roboto_12, .text = "chip 0603", .ofs_x = 0, .ofs_y = 2, .width = 54, .height = 13, .data = sprite_12 },
+    { .font = &my_font_roboto_12, .text = "chip 0805", .ofs_x = 0, .ofs_y = 2, .width = 54, .height = 13, .data = sprite_13 },
+    { .font = &my_font_roboto_12, .text = "chip 1206", .ofs_x = 0, .ofs_y = 2, .width = 54, .height = 13, .data = sprite_14 },
+    { .font = &my_font_roboto_12, .text = "chip 2512", .ofs_x = 0, .ofs_y = 2, .width = 54, .height = 13, .data = sprite_15 },
+#endif
+    { .font = NULL, .text = NULL, .ofs_x = 0, .ofs_y = 0, .width = 0, .height = 0, .data = NULL }
+};
@@ -0,0 +1,120 @@
+#include "glyph_cache.h"
+#include "app_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SLOTS_COUNT (GLYPH_CACHE_SIZE / GLYPH_CACHE_SLOT_SIZE)
+
+glyph_cache_stats_t glyph_cache_stats;
+
+#if SLOTS_COUNT > 0
+
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    uint16_t used;  // LRU stamp
+} slot_t;
+
+static slot_t slots[SLOTS_COUNT];
+static uint8_t slots_data[SLOTS_COUNT][GLYPH_CACHE_SLOT_SIZE];
+static uint16_t stamp = 0;
+
+// Size of unpacked bitmap. 3 bpp glyphs are unpacked to 4 bpp.
+static uint32_t bitmap_size(const lv_font_t * font, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+
+    if (!lv_font_get_glyph_dsc(font, &g, letter, 0)) return 0;
+
+    uint32_t px = g.box_w * g.box_h;
+
+    switch (g.bpp)
+    {
+        case 1: return (px + 7) >> 3;
+        case 2: return (px + 3) >> 2;
+        default: return (px + 1) >> 1;
+    }
+}
+
+static const uint8_t * cached_get_glyph_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    slot_t * lru = &slots[0];
+
+    stamp++;
+
+    for (uint8_t i = 0; i < SLOTS_COUNT; i++)
+    {
+        slot_t * slot = &slots[i];
+
+        if (slot->font == font && slot->letter == letter)
+        {
+            slot->used = stamp;
+            glyph_cache_stats.hits++;
+            return slots_data[i];
+        }
+
+        if ((uint16_t)(stamp - slot->used) > (uint16_t)(stamp - lru->used)) lru = slot;
+    }
+
+    uint32_t started_at = hal::micros();
+
+    const uint8_t * bitmap = lv_font_get_bitmap_fmt_txt(font, letter);
+    uint32_t size = bitmap ? bitmap_size(font, letter) : 0;
+
+    if (size && size <= GLYPH_CACHE_SLOT_SIZE)
+    {
+        memcpy(slots_data[lru - slots], bitmap, size);
+        lru->font = font;
+        lru->letter = letter;
+        lru->used = stamp;
+    }
+    else glyph_cache_stats.uncached++;
+
+    glyph_cache_stats.misses++;
+    glyph_cache_stats.miss_us += hal::micros() - started_at;
+
+    return bitmap;
+}
+
+bool glyph_cache_attach(lv_font_t * font)
+{
+    if (font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return false;
+
+    auto * fdsc = reinterpret_cast<const lv_font_fmt_txt_dsc_t *>(font->dsc);
+
+    if (fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) return false;
+
+    font->get_glyph_bitmap = cached_get_glyph_bitmap;
+    return true;
+}
+
+#else
+
+bool glyph_cache_attach(lv_font_t * font)
+{
+    (void)font;
+    return false;
+}
+
+#endif
+
+void glyph_cache_print(const char * eol)
+{
+    glyph_cache_stats_t & s = glyph_cache_stats;
+    uint32_t total = s.hits + s.misses;
+
+    if (!total) return;
+
+    printf(
+        "[Glyphs] hits: %d, misses: %d (%d uncached), hit rate: %d%%, saved: ~%d us%s",
+        (int)s.hits,
+        (int)s.misses,
+        (int)s.uncached,
+        (int)(s.hits * 100 / total),
+        s.misses ? (int)((uint64_t)s.hits * s.miss_us / s.misses) : 0,
+        eol
+    );
+
+    memset(&s, 0, sizeof(s));
+}
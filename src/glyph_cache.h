@@ -0,0 +1,44 @@
+#ifndef __GLYPH_CACHE__
+#define __GLYPH_CACHE__
+
+// LRU cache of decompressed glyph bitmaps. LVGL unpacks glyph of compressed
+// font on every draw, and the same glyphs (digits on flow screen, list
+// titles) are drawn again and again.
+//
+// Only compressed fonts are attached (`build_fonts.js` without `nocompress`,
+// saves ~1/3 of fonts flash). Plain fonts are read from flash directly, and
+// cache can't make those faster.
+//
+// RAM budget is split into equal slots. Glyphs bigger than slot are not
+// cached. Default fonts are not compressed, so cache is off (0) by default.
+// Set GLYPH_CACHE_SIZE, when building compressed fonts (960 is a good
+// start).
+
+#include "lvgl.h"
+
+#ifndef GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_SIZE 0
+#endif
+
+#ifndef GLYPH_CACHE_SLOT_SIZE
+#define GLYPH_CACHE_SLOT_SIZE 80
+#endif
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t miss_us;   // time spent on misses (unpack & copy)
+    uint32_t uncached;  // misses of glyphs, too big for slot
+} glyph_cache_stats_t;
+
+// Reset by `glyph_cache_print()`
+extern glyph_cache_stats_t glyph_cache_stats;
+
+// Route font bitmap reads via cache. Returns false for not compressed font.
+bool glyph_cache_attach(lv_font_t * font);
+
+// Print hit rate & estimated time saved (hits * average miss time), and
+// reset counters. Nothing is printed when cache was not used.
+void glyph_cache_print(const char * eol);
+
+#endif
@@ -0,0 +1,135 @@
+#include "input_stats.h"
+#include "app_hal.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static input_stats_t stats;
+
+// Press, waiting for motor reaction
+static volatile bool start_pending = false;
+static uint32_t start_at;
+
+// Keypad press, waiting for frame with result
+enum {
+    KEY_IDLE,
+    KEY_ARMED,      // press passed to LVGL, no flush yet
+    KEY_FRAME,      // frame with result is being flushed
+    KEY_CLOSING     // frame rendered, last flush in progress
+};
+
+static volatile uint8_t key_state = KEY_IDLE;
+static uint32_t key_at;
+static uint8_t key_screen;
+static uint8_t screen = INPUT_SCREEN_DOSE;
+
+// Flushes of measured frame. Started are counted in main loop, ended - in
+// flush interrupt.
+static uint16_t flushes_started;
+static volatile uint16_t flushes_ended;
+static volatile uint32_t flush_end_at;
+
+
+void input_stats_start_press(uint32_t at)
+{
+    start_at = at;
+    start_pending = true;
+}
+
+void input_stats_coil_on()
+{
+    if (!start_pending) return;
+
+    start_pending = false;
+    stats_hist_add(&stats.start_us, hal::micros() - start_at);
+}
+
+
+void input_stats_set_screen(uint8_t value)
+{
+    if (value < INPUT_SCREEN_COUNT) screen = value;
+}
+
+void input_stats_key_press(uint32_t at)
+{
+    // Measure the first press of frame only
+    if (key_state == KEY_FRAME || key_state == KEY_CLOSING) return;
+
+    key_at = at;
+    key_screen = screen;
+    key_state = KEY_ARMED;
+}
+
+static void key_done(uint32_t at)
+{
+    stats_hist_add(&stats.key_us[key_screen], at - key_at);
+    key_state = KEY_IDLE;
+}
+
+void input_stats_flush_start()
+{
+    // LVGL waits for previous flush before the next one. If frame is still
+    // not closed, its end was missed in race with interrupt - drop it.
+    if (key_state == KEY_CLOSING) key_state = KEY_IDLE;
+
+    if (key_state == KEY_ARMED)
+    {
+        flushes_started = 0;
+        flushes_ended = 0;
+        key_state = KEY_FRAME;
+    }
+
+    if (key_state == KEY_FRAME) flushes_started++;
+}
+
+void input_stats_flush_end(uint32_t at)
+{
+    uint8_t st = key_state;
+
+    if (st != KEY_FRAME && st != KEY_CLOSING) return;
+
+    flush_end_at = at;
+    flushes_ended = (uint16_t)(flushes_ended + 1);
+
+    if (st == KEY_CLOSING && flushes_ended == flushes_started) key_done(at);
+}
+
+void input_stats_frame_end()
+{
+    if (key_state != KEY_FRAME) return;
+
+    // Flush is synchronous, or DMA finished already
+    if (flushes_ended == flushes_started)
+    {
+        key_done(flush_end_at);
+        return;
+    }
+
+    // Last DMA transfer still runs, interrupt will close frame
+    key_state = KEY_CLOSING;
+}
+
+
+void input_stats_print(const char * eol)
+{
+    if (stats.start_us.count)
+    {
+        printf("[Input] latency%s", eol);
+        stats_hist_print("start key to motor us", &stats.start_us, eol);
+    }
+
+    static const char * const screen_names[INPUT_SCREEN_COUNT] = {
+        "dose", "flow", "settings"
+    };
+
+    for (uint8_t i = 0; i < INPUT_SCREEN_COUNT; i++)
+    {
+        if (!stats.key_us[i].count) continue;
+
+        printf("[Input] %s screen%s", screen_names[i], eol);
+        stats_hist_print("key to panel us", &stats.key_us[i], eol);
+    }
+
+    // Not atomic, but counters from interrupts can't break anything here
+    memset(&stats, 0, sizeof(stats));
+}
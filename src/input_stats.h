@@ -0,0 +1,44 @@
+#ifndef __INPUT_STATS__
+#define __INPUT_STATS__
+
+// Input latency counters. HAL reports events with timestamps from
+// `hal::micros()`, sysmon prints collected data and starts new period.
+//
+// Keypad latency is measured from press event to the end of the first frame
+// flushed after LVGL has processed it (last SPI transfer done), per screen.
+// Press without visible result is replaced by the next one.
+
+#include "display_stats.h"
+
+enum {
+    INPUT_SCREEN_DOSE,
+    INPUT_SCREEN_FLOW,
+    INPUT_SCREEN_SETTINGS,
+    INPUT_SCREEN_COUNT
+};
+
+typedef struct {
+    stats_hist_t start_us;      // start key press -> first motor coil on, us
+    stats_hist_t key_us[INPUT_SCREEN_COUNT];    // keypad press -> on panel, us
+} input_stats_t;
+
+// Start key press accepted, `at` is pin edge time. Can be called from
+// interrupt.
+void input_stats_start_press(uint32_t at);
+// Motor coil energized. Call from the same interrupt priority as above.
+void input_stats_coil_on();
+
+// Screen, which gets keypad input (INPUT_SCREEN_...)
+void input_stats_set_screen(uint8_t screen);
+// Keypad press is passed to LVGL, `at` is event time
+void input_stats_key_press(uint32_t at);
+// Called from display stats hooks. `flush_end()` can be called from
+// interrupt.
+void input_stats_flush_start();
+void input_stats_flush_end(uint32_t at);
+void input_stats_frame_end();
+
+// Print histograms, if any, and reset counters
+void input_stats_print(const char * eol);
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef __KEY_QUEUE__
+#define __KEY_QUEUE__
+
+// Lock-free ring of key events, for single producer & single consumer.
+//
+// Producer (key scan, interrupt or input thread) calls `push()`, consumer
+// (LVGL indev) calls `pop()`. Each index is written by one side only, and
+// event data is stored before index update, so no locks needed. `SIZE` must
+// be a power of 2, up to 128.
+
+#include <stdint.h>
+#include <atomic>
+
+typedef struct {
+    uint32_t key;
+    uint32_t time;      // hal::micros() of event
+    bool pressed;
+} key_event_t;
+
+template <uint8_t SIZE>
+class KeyQueue
+{
+    static_assert(SIZE && SIZE <= 128 && (SIZE & (SIZE - 1)) == 0, "Size must be power of 2");
+
+    key_event_t events[SIZE];
+    // Free running counters, wrap via uint8_t overflow
+    volatile uint8_t head = 0;
+    volatile uint8_t tail = 0;
+
+public:
+    // Number of events, dropped because queue was full
+    volatile uint32_t overflows = 0;
+
+    // Returns false if queue is full, event is dropped then
+    bool push(const key_event_t & event)
+    {
+        uint8_t h = head;
+
+        if ((uint8_t)(h - tail) >= SIZE)
+        {
+            overflows = overflows + 1;
+            return false;
+        }
+
+        events[h & (SIZE - 1)] = event;
+        std::atomic_thread_fence(std::memory_order_release);
+        head = (uint8_t)(h + 1);
+        return true;
+    }
+
+    bool pop(key_event_t & event)
+    {
+        uint8_t t = tail;
+
+        if (t == head) return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        event = events[t & (SIZE - 1)];
+        // Slot must be read before producer can reuse it
+        std::atomic_thread_fence(std::memory_order_release);
+        tail = (uint8_t)(t + 1);
+        return true;
+    }
+
+    bool empty() const { return head == tail; }
+};
+
+#endif
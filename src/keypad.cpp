@@ -0,0 +1,45 @@
+#include "keypad.h"
+#include "app.h"
+#include "app_hal.h"
+#include "input_stats.h"
+#include "refresh_governor.h"
+
+static KeyQueue<KEYPAD_QUEUE_SIZE> queue;
+
+// Reported to LVGL, when queue is empty
+static key_event_t last = { 0, 0, false };
+
+
+void keypad_push(uint32_t key, bool pressed)
+{
+    key_event_t event = { key, hal::micros(), pressed };
+
+    queue.push(event);
+}
+
+bool keypad_read(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    (void)drv;
+
+    if (queue.pop(last))
+    {
+        // Show result at the next loop, without waiting refresh period
+        refresh_governor_input();
+
+        if (last.pressed) input_stats_key_press(last.time);
+        // Notify only if LVGL has seen the press. Read callback can be
+        // wrapped, and press hidden (display wake).
+        else if (app_data.group && app_data.kbd &&
+            app_data.kbd->proc.types.keypad.last_state == LV_INDEV_STATE_PR)
+        {
+            lv_obj_t * focused = lv_group_get_focused(app_data.group);
+            if (focused) lv_event_send(focused, APP_EVENT_KEY_RELEASED, &last.key);
+        }
+    }
+
+    data->key = last.key;
+    data->state = last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+
+    // Ask LVGL to read again, until queue is empty
+    return !queue.empty();
+}
@@ -0,0 +1,24 @@
+#ifndef __KEYPAD__
+#define __KEYPAD__
+
+// Keypad input for LVGL. HAL pushes timestamped press/release events from
+// key scan, interrupt or input thread, LVGL indev drains them one by one. So
+// fast clicks are not lost or merged, even if LVGL reads input rarely.
+//
+// LVGL 6 sends LV_EVENT_RELEASED for ENTER only. For other keys, release is
+// sent to focused object as APP_EVENT_KEY_RELEASED, with key code in data.
+
+#include "lvgl.h"
+#include "key_queue.h"
+
+#ifndef KEYPAD_QUEUE_SIZE
+#define KEYPAD_QUEUE_SIZE 16
+#endif
+
+// Add event (LV_KEY_...). Single producer only, can be interrupt.
+void keypad_push(uint32_t key, bool pressed);
+
+// Indev `read_cb`
+bool keypad_read(lv_indev_drv_t * drv, lv_indev_data_t * data);
+
+#endif
@@ -27,7 +27,7 @@
 
 /* Swap the 2 bytes of RGB565 color.
  * Useful if the display has a 8 bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP   1
+#define LV_COLOR_16_SWAP   0 /* ST7735 gets pixels as 16-bit SPI frames */
 
 /* 1: Enable screen transparency.
  * Useful for OSD or other overlapping GUIs.
@@ -0,0 +1,159 @@
+#include "page_scroll.h"
+#include "app_hal.h"
+
+static lv_obj_t * scroll_page = NULL;
+static bool hw_scroll = false;
+// Scrolled rows, screen coordinates
+static lv_area_t band;
+
+
+void page_scroll_attach(lv_obj_t * page)
+{
+    scroll_page = page;
+    lv_obj_get_coords(page, &band);
+
+    hw_scroll = lv_area_get_width(&band) == lv_disp_get_hor_res(lv_obj_get_disp(page)) &&
+        hal::display_scroll_area(band.y1, lv_area_get_height(&band));
+}
+
+
+void page_scroll_detach()
+{
+    if (!scroll_page) return;
+
+    if (hw_scroll)
+    {
+        hal::display_scroll_area(0, 0);
+        // Band rows are shuffled in display memory, redraw all
+        lv_inv_area(lv_obj_get_disp(scroll_page), &band);
+    }
+
+    scroll_page = NULL;
+    hw_scroll = false;
+}
+
+
+// Scrollbar column of page, screen coordinates
+static void scrollbar_area(lv_obj_t * page, lv_area_t * area)
+{
+    lv_page_ext_t * ext = (lv_page_ext_t *)lv_obj_get_ext_attr(page);
+
+    *area = band;
+    area->x1 = page->coords.x1 + ext->sb.ver_area.x1;
+    area->x2 = page->coords.x1 + ext->sb.ver_area.x2;
+}
+
+// Drop areas, invalidated since `from` and lying inside band - content,
+// moved by hardware. Others are kept. Scrollbar moves over band, and its
+// areas could be merged into dropped ones, so its column is invalidated
+// before & after move. Returns false if LVGL switched to full redraw.
+static bool drop_band_areas(lv_obj_t * page, lv_disp_t * disp, uint16_t from,
+                            const lv_area_t * sb_prev)
+{
+    if (disp->inv_p < from) return false;
+
+    uint16_t n = from;
+
+    for (uint16_t i = from; i < disp->inv_p; i++)
+    {
+        if (lv_area_is_in(&disp->inv_areas[i], &band)) continue;
+
+        disp->inv_areas[n++] = disp->inv_areas[i];
+    }
+
+    disp->inv_p = n;
+
+    if (lv_page_get_sb_mode(page) != LV_SB_MODE_OFF)
+    {
+        lv_area_t sb;
+        scrollbar_area(page, &sb);
+
+        lv_inv_area(disp, sb_prev);
+        lv_inv_area(disp, &sb);
+    }
+
+    return true;
+}
+
+// Move page content to new position. Areas, invalidated by move, are
+// dropped, and only exposed rows are redrawn.
+static void scroll_anim_cb(void * var, lv_anim_value_t value)
+{
+    lv_obj_t * scrl = (lv_obj_t *)var;
+    lv_obj_t * page = lv_obj_get_parent(scrl);
+    lv_disp_t * disp = lv_obj_get_disp(scrl);
+    lv_coord_t y_prev = lv_obj_get_y(scrl);
+    uint16_t inv_p = disp->inv_p;
+    lv_area_t sb_prev;
+
+    if (value == y_prev) return;
+
+    scrollbar_area(page, &sb_prev);
+    lv_obj_set_y(scrl, value);
+
+    // Invalidate buffer overflow => LVGL redraws the whole screen anyway
+    if (!drop_band_areas(page, disp, inv_p, &sb_prev)) return;
+
+    // Page can limit position
+    lv_coord_t dy = lv_obj_get_y(scrl) - y_prev;
+
+    if (!dy) return;
+
+    // Areas, waiting for redraw, are moved together with content. Extend
+    // those to be sure.
+    for (uint16_t i = 0; i < inv_p; i++)
+    {
+        lv_area_t * a = &disp->inv_areas[i];
+
+        if (a->y2 < band.y1 || a->y1 > band.y2) continue;
+
+        if (dy > 0) a->y2 = LV_MATH_MAX(a->y2, LV_MATH_MIN(a->y2 + dy, band.y2));
+        else a->y1 = LV_MATH_MIN(a->y1, LV_MATH_MAX(a->y1 + dy, band.y1));
+    }
+
+    hal::display_scroll(dy);
+
+    lv_area_t exposed = band;
+
+    if (dy > 0) exposed.y2 = LV_MATH_MIN(band.y1 + dy - 1, band.y2);
+    else exposed.y1 = LV_MATH_MAX(band.y2 + dy + 1, band.y1);
+
+    lv_inv_area(disp, &exposed);
+}
+
+
+void page_scroll_focus(lv_obj_t * page, lv_obj_t * obj)
+{
+    if (page != scroll_page || !hw_scroll)
+    {
+        lv_page_focus(page, obj, LV_ANIM_ON);
+        return;
+    }
+
+    lv_obj_t * scrl = lv_page_get_scrl(page);
+    lv_disp_t * disp = lv_obj_get_disp(page);
+    uint16_t inv_p = disp->inv_p;
+    lv_coord_t y_start = lv_obj_get_y(scrl);
+    lv_area_t sb_prev;
+
+    // Let LVGL calculate final position, then move back. Content is not
+    // changed, so drop invalidated band areas.
+    scrollbar_area(page, &sb_prev);
+    lv_page_focus(page, obj, LV_ANIM_OFF);
+    lv_coord_t y_end = lv_obj_get_y(scrl);
+    lv_obj_set_y(scrl, y_start);
+
+    // On buffer overflow it's simpler to leave all to LVGL
+    if (!drop_band_areas(page, disp, inv_p, &sb_prev))
+    {
+        lv_page_focus(page, obj, LV_ANIM_ON);
+        return;
+    }
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, scrl, scroll_anim_cb);
+    lv_anim_set_values(&a, y_start, y_end);
+    lv_anim_set_time(&a, lv_page_get_anim_time(page), 0);
+    lv_anim_create(&a);
+}
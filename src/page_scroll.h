@@ -0,0 +1,21 @@
+#ifndef __PAGE_SCROLL__
+#define __PAGE_SCROLL__
+
+// List page scroll with display hardware acceleration. When focused item
+// changes, already drawn content is shifted by display controller, and LVGL
+// renders only exposed rows. Page must be full-width and have solid
+// background.
+//
+// If HAL has no hardware scroll, usual `lv_page_focus()` is used.
+
+#include "lvgl.h"
+
+// Call after page size & position set
+void page_scroll_attach(lv_obj_t * page);
+// Call before page delete
+void page_scroll_detach();
+
+// Animated scroll to make `obj` visible, like `lv_page_focus()`
+void page_scroll_focus(lv_obj_t * page, lv_obj_t * obj);
+
+#endif
@@ -0,0 +1,86 @@
+#include "refresh_governor.h"
+
+#include <stdio.h>
+#include <string.h>
+
+governor_stats_t governor_stats;
+
+static uint32_t period = GOVERNOR_PERIOD_MIN;
+static bool busy = false;
+static uint32_t busy_since = 0;
+
+
+void refresh_governor_set_busy(bool value)
+{
+    if (busy == value) return;
+
+    busy = value;
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_task_set_period(disp->refr_task, busy ? GOVERNOR_REFR_PERIOD_BUSY : LV_DISP_DEF_REFR_PERIOD);
+
+    if (busy) busy_since = lv_tick_get();
+    else
+    {
+        governor_stats.busy_ms += lv_tick_elaps(busy_since);
+        // Show deferred changes without delay
+        lv_task_ready(disp->refr_task);
+    }
+}
+
+
+void refresh_governor_input()
+{
+    if (busy) return;
+
+    lv_task_ready(lv_disp_get_default()->refr_task);
+}
+
+
+uint32_t refresh_governor_update()
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    // Refresh can be paused (display sleep), then redraw waits
+    bool pending = disp->inv_p > 0 && disp->refr_task->prio != LV_TASK_PRIO_OFF;
+
+    governor_stats.calls++;
+    if (busy && pending) governor_stats.deferred++;
+
+    if (pending || lv_anim_count_running() ||
+        lv_disp_get_inactive_time(disp) < GOVERNOR_IDLE_DELAY)
+    {
+        period = GOVERNOR_PERIOD_MIN;
+        return period;
+    }
+
+    period = LV_MATH_MIN(period * 2, GOVERNOR_PERIOD_IDLE);
+    governor_stats.idle_calls++;
+
+    return period;
+}
+
+
+void refresh_governor_print(const char * eol)
+{
+    governor_stats_t & s = governor_stats;
+    uint32_t busy_ms = s.busy_ms;
+
+    // Count current busy period up to now, the rest goes to the next report
+    if (busy)
+    {
+        busy_ms += lv_tick_elaps(busy_since);
+        busy_since = lv_tick_get();
+    }
+
+    printf(
+        "[Governor] calls: %d, idle: %d, period: %d ms, busy: %d ms, deferred: %d%s",
+        (int)s.calls,
+        (int)s.idle_calls,
+        (int)period,
+        (int)busy_ms,
+        (int)s.deferred,
+        eol
+    );
+
+    memset(&s, 0, sizeof(s));
+}
@@ -0,0 +1,56 @@
+#ifndef __REFRESH_GOVERNOR__
+#define __REFRESH_GOVERNOR__
+
+// Adapts main loop & display refresh rates to load.
+//
+// - Idle (nothing to redraw, no animations, no input for a while): period
+//   of `lv_task_handler()` calls grows from GOVERNOR_PERIOD_MIN up to
+//   GOVERNOR_PERIOD_IDLE. Active state restores min period at once. Keys must
+//   be scanned from timer, not from LVGL task, to keep debounce time.
+// - Busy (motor runs): display refresh period is raised to
+//   GOVERNOR_REFR_PERIOD_BUSY. Redraws & animation frames are deferred, so
+//   rendering and SPI transfers do not compete with motion. Input and other
+//   tasks still run at normal rate.
+
+#include "lvgl.h"
+
+#ifndef GOVERNOR_PERIOD_MIN
+#define GOVERNOR_PERIOD_MIN 5
+#endif
+
+#ifndef GOVERNOR_PERIOD_IDLE
+#define GOVERNOR_PERIOD_IDLE 30
+#endif
+
+// No input time, before loop slows down, ms
+#ifndef GOVERNOR_IDLE_DELAY
+#define GOVERNOR_IDLE_DELAY 1000
+#endif
+
+#ifndef GOVERNOR_REFR_PERIOD_BUSY
+#define GOVERNOR_REFR_PERIOD_BUSY 250
+#endif
+
+typedef struct {
+    uint32_t calls;         // lv_task_handler() calls
+    uint32_t idle_calls;    // calls with increased period
+    uint32_t deferred;      // calls with redraw pending while busy
+    uint32_t busy_ms;       // time with throttled refresh
+} governor_stats_t;
+
+// Reset by `refresh_governor_print()`
+extern governor_stats_t governor_stats;
+
+void refresh_governor_set_busy(bool busy);
+
+// Keypad event passed to LVGL. Redraw is scheduled for the next loop instead
+// of waiting refresh period, unless busy.
+void refresh_governor_input();
+
+// Call after `lv_task_handler()`. Returns delay before the next call, ms.
+uint32_t refresh_governor_update();
+
+// Print counters and reset those
+void refresh_governor_print(const char * eol);
+
+#endif
@@ -1,5 +1,7 @@
 #include "app.h"
 #include "screen_dose.h"
+#include "page_scroll.h"
+#include "text_sprites.h"
 #include "doses.h"
 #include "etl/cyclic_value.h"
 
@@ -10,42 +12,27 @@ static bool destroyed = true;
 
 static lv_design_cb_t orig_design_cb;
 
+// Item user data is library entry, loaded once on list create. Freed on
+// item delete.
+static dose_entry_t * item_dose(lv_obj_t * obj)
+{
+    return reinterpret_cast<dose_entry_t *>(lv_obj_get_user_data(obj));
+}
+
 // Custom drawer to avoid labels create & save RAM.
 static bool list_item_design_cb(lv_obj_t * obj, const lv_area_t * mask_p, lv_design_mode_t mode)
 {
-    auto * dose = reinterpret_cast<dose_t *>(lv_obj_get_user_data(obj));
-
     if(mode == LV_DESIGN_DRAW_MAIN)
     {
         orig_design_cb(obj, mask_p, mode);
 
+        dose_entry_t * dose = item_dose(obj);
+
         lv_point_t title_pos = { .x = 4, .y = 4 };
-        lv_draw_label(
-            &obj->coords,
-            mask_p,
-            &app_data.styles.list_title,
-            lv_obj_get_opa_scale(obj),
-            dose->title,
-            LV_TXT_FLAG_NONE,
-            &title_pos,
-            NULL,
-            NULL,
-            lv_obj_get_base_dir(obj)
-        );
+        text_sprite_draw(obj, mask_p, &app_data.styles.list_title, dose->title, &title_pos);
 
         lv_point_t desc_pos = { .x = 4, .y = 19 };
-        lv_draw_label(
-            &obj->coords,
-            mask_p,
-            &app_data.styles.list_desc,
-            lv_obj_get_opa_scale(obj),
-            dose->desc,
-            LV_TXT_FLAG_NONE,
-            &desc_pos,
-            NULL,
-            NULL,
-            lv_obj_get_base_dir(obj)
-        );
+        text_sprite_draw(obj, mask_p, &app_data.styles.list_desc, dose->desc, &desc_pos);
 
         return true;
     }
@@ -66,11 +53,17 @@ static void group_style_mod_cb(lv_group_t * group, lv_style_t * style)
 
 static void screen_dose_menu_item_cb(lv_obj_t * item, lv_event_t e)
 {
+    if (e == LV_EVENT_DELETE)
+    {
+        lv_mem_free(item_dose(item));
+        return;
+    }
+
     if (destroyed) return;
 
     // Next part is for keyboard only
     if ((e != LV_EVENT_KEY) && (e != LV_EVENT_LONG_PRESSED) &&
-        (e != LV_EVENT_RELEASED) && (e != HACK_EVENT_RELEASED)) {
+        (e != LV_EVENT_RELEASED) && (e != APP_EVENT_KEY_RELEASED)) {
         return;
     }
 
@@ -80,7 +73,8 @@ static void screen_dose_menu_item_cb(lv_obj_t * item, lv_event_t e)
     switch (e)
     {
         // All keys except enter have `LV_EVENT_KEY` event for both
-        // click & repeat. And do not provide release & long press events.
+        // click & repeat. And do not provide release & long press events
+        // (release comes as APP_EVENT_KEY_RELEASED).
         case LV_EVENT_KEY:
             switch (key_code)
             {
@@ -90,7 +84,7 @@ static void screen_dose_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
                     lv_group_focus_prev(app_data.group);
                     // Scroll focused to visible area
-                    lv_page_focus(page, lv_group_get_focused(app_data.group), true);
+                    page_scroll_focus(page, lv_group_get_focused(app_data.group));
                     return;
 
                 case LV_KEY_DOWN:
@@ -99,7 +93,7 @@ static void screen_dose_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
                     lv_group_focus_next(app_data.group);
                     // Scroll focused to visible area
-                    lv_page_focus(page, lv_group_get_focused(app_data.group), true);
+                    page_scroll_focus(page, lv_group_get_focused(app_data.group));
                     return;
             }
             return;
@@ -124,13 +118,11 @@ static void screen_dose_menu_item_cb(lv_obj_t * item, lv_event_t e)
             }
             return;
 
-        // injected event from hacked driver
-        case HACK_EVENT_RELEASED:
+        // release of other keys, from keypad driver
+        case APP_EVENT_KEY_RELEASED:
             skip_cnt = 0;
             return;
     }
-
-    (void)item;
 }
 
 
@@ -138,9 +130,7 @@ static void focus_cb(lv_group_t * group)
 {
     if (destroyed) return;
 
-    auto * dose = reinterpret_cast<dose_t *>(
-        lv_obj_get_user_data(lv_group_get_focused(group))
-    );
+    dose_entry_t * dose = item_dose(lv_group_get_focused(group));
 
     if (app_data.dose_volume != dose->volume)
     {
@@ -177,29 +167,38 @@ void screen_dose_create()
         lv_obj_get_height(lv_scr_act()) - LIST_MARGIN_TOP
     );
     lv_obj_set_pos(page, 0, LIST_MARGIN_TOP);
+    page_scroll_attach(page);
 
     lv_obj_t * selected_item = NULL;
+    dose_entry_t dose;
+    float first_volume = 0;
 
-    for (int i=0; doses[i].volume != 0; i++)
+    for (uint8_t i = 0; dose_load(i, &dose); i++)
     {
+        if (i == 0) first_volume = dose.volume;
+
+        dose_entry_t * cached = (dose_entry_t *)lv_mem_alloc(sizeof(dose_entry_t));
+        if (!cached) break;
+        *cached = dose;
+
         //
         // Create list item & attach user data
         //
 
         lv_obj_t * item = lv_obj_create(page, NULL);
-        lv_obj_set_user_data(item, const_cast<dose_t *>(&doses[i]));
+        lv_obj_set_user_data(item, cached);
         lv_obj_set_style(item, &app_data.styles.list_item);
         lv_obj_set_size(item, lv_obj_get_width(page), 37);
         lv_obj_set_event_cb(item, screen_dose_menu_item_cb);
         lv_group_add_obj(app_data.group, item);
 
         // We use custom drawer to avoid labels use and reduce RAM comsumption
-        // significantly. Now it's ~ 170 bytes per entry.
+        // significantly. Now it's ~ 170 bytes per entry, plus cached entry.
         // Since all callbacks are equal - use the same var to store old ones.
         orig_design_cb = lv_obj_get_design_cb(item);
         lv_obj_set_design_cb(item, list_item_design_cb);
 
-        if (app_data.dose_volume == doses[i].volume) selected_item = item;
+        if (app_data.dose_volume == dose.volume) selected_item = item;
     }
 
     //
@@ -216,7 +215,7 @@ void screen_dose_create()
     }
     else
     {
-        app_data.dose_volume = doses[0].volume;
+        app_data.dose_volume = first_volume;
         app_update_settings();
     }
 
@@ -233,5 +232,6 @@ void screen_dose_destroy()
     lv_group_set_focus_cb(app_data.group, NULL);
     lv_group_set_style_mod_cb(app_data.group, NULL);
     lv_group_remove_all_objs(app_data.group);
+    page_scroll_detach();
     lv_obj_clean(lv_scr_act());
 }
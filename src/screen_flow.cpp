@@ -72,8 +72,8 @@ static const param_data_t scale = {
     .val_redraw_fn = &base_redraw_fn,
     .val_update_fn = &base_update_value_fn,
     .val_ref = &app_data.speed_scale,
-    .min_value = 0.1f,
-    .max_value = 9.9f,
+    .min_value = SPEED_SCALE_MIN,
+    .max_value = SPEED_SCALE_MAX,
     .min_step = 0.1f,
     .max_step = 1.0f,
     .precision = 1,
@@ -87,7 +87,7 @@ static void screen_flow_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
     // Next part is for keyboard only
     if ((e != LV_EVENT_KEY) && (e != LV_EVENT_LONG_PRESSED) &&
-        (e != LV_EVENT_RELEASED) && (e != HACK_EVENT_RELEASED)) {
+        (e != LV_EVENT_RELEASED) && (e != APP_EVENT_KEY_RELEASED)) {
         return;
     }
 
@@ -96,7 +96,8 @@ static void screen_flow_menu_item_cb(lv_obj_t * item, lv_event_t e)
     switch (e)
     {
         // All keys except enter have `LV_EVENT_KEY` event for both
-        // click & repeat. And do not provide release & long press events.
+        // click & repeat. And do not provide release & long press events
+        // (release comes as APP_EVENT_KEY_RELEASED).
         case LV_EVENT_KEY:
             switch (key_code)
             {
@@ -129,8 +130,8 @@ static void screen_flow_menu_item_cb(lv_obj_t * item, lv_event_t e)
             }
             return;
 
-        // injected event from hacked driver
-        case HACK_EVENT_RELEASED:
+        // release of other keys, from keypad driver
+        case APP_EVENT_KEY_RELEASED:
             switch (key_code)
             {
                 case LV_KEY_LEFT:
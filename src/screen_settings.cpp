@@ -1,5 +1,7 @@
 #include "app.h"
 #include "screen_settings.h"
+#include "page_scroll.h"
+#include "text_sprites.h"
 #include "etl/to_string.h"
 #include "etl/cyclic_value.h"
 
@@ -79,8 +81,8 @@ static setting_data_t s_data_needle = {
     .val_redraw_fn = &base_redraw_fn,
     .val_update_fn = &base_update_value_fn,
     .val_ref = &app_data.needle_dia,
-    .min_value = 0.3f,
-    .max_value = 2.0f,
+    .min_value = NEEDLE_DIA_MIN,
+    .max_value = NEEDLE_DIA_MAX,
     .min_step = 0.1f,
     .max_step = 0.1f,
     .precision = 1,
@@ -97,8 +99,8 @@ static const setting_data_t s_data_syringe = {
     .val_get_text_fn = &base_get_text_fn,
     .val_update_fn = &base_update_value_fn,
     .val_ref = &app_data.syringe_dia,
-    .min_value = 4.0f,
-    .max_value = 30.0f,
+    .min_value = SYRINGE_DIA_MIN,
+    .max_value = SYRINGE_DIA_MAX,
     .min_step = 0.1f,
     .max_step = 1.0f,
     .precision = 1,
@@ -115,8 +117,8 @@ static const setting_data_t s_data_viscosity = {
     .val_get_text_fn = &base_get_text_fn,
     .val_update_fn = &base_update_value_fn,
     .val_ref = &app_data.viscosity,
-    .min_value = 1.0f,
-    .max_value = 1000.0f,
+    .min_value = VISCOSITY_MIN,
+    .max_value = VISCOSITY_MAX,
     .min_step = 1.0f,
     .max_step = 100.0f,
     .precision = 1,
@@ -133,8 +135,8 @@ static const setting_data_t s_data_flux_percent = {
     .val_get_text_fn = &base_get_text_fn,
     .val_update_fn = &base_update_value_fn,
     .val_ref = &app_data.flux_percent,
-    .min_value = 1.0f,
-    .max_value = 50.0f,
+    .min_value = FLUX_PERCENT_MIN,
+    .max_value = FLUX_PERCENT_MAX,
     .min_step = 1.0f,
     .max_step = 3.0f,
     .precision = 0,
@@ -189,18 +191,7 @@ static bool list_item_design_cb(lv_obj_t * obj, const lv_area_t * mask_p, lv_des
         orig_design_cb(obj, mask_p, mode);
 
         lv_point_t title_pos = { .x = 4, .y = 4 };
-        lv_draw_label(
-            &obj->coords,
-            mask_p,
-            &app_data.styles.list_title,
-            lv_obj_get_opa_scale(obj),
-            s_data->title,
-            LV_TXT_FLAG_NONE,
-            &title_pos,
-            NULL,
-            NULL,
-            lv_obj_get_base_dir(obj)
-        );
+        text_sprite_draw(obj, mask_p, &app_data.styles.list_title, s_data->title, &title_pos);
 
         lv_point_t desc_pos = { .x = 4, .y = 19 };
         lv_draw_label(
@@ -239,7 +230,7 @@ static void screen_settings_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
     // Next part is for keyboard only
     if ((e != LV_EVENT_KEY) && (e != LV_EVENT_LONG_PRESSED) &&
-        (e != LV_EVENT_RELEASED) && (e != HACK_EVENT_RELEASED)) {
+        (e != LV_EVENT_RELEASED) && (e != APP_EVENT_KEY_RELEASED)) {
         return;
     }
 
@@ -250,7 +241,8 @@ static void screen_settings_menu_item_cb(lv_obj_t * item, lv_event_t e)
     switch (e)
     {
         // All keys except enter have `LV_EVENT_KEY` event for both
-        // click & repeat. And do not provide release & long press events.
+        // click & repeat. And do not provide release & long press events
+        // (release comes as APP_EVENT_KEY_RELEASED).
         case LV_EVENT_KEY:
             switch (key_code)
             {
@@ -261,7 +253,7 @@ static void screen_settings_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
                     lv_group_focus_prev(app_data.group);
                     // Scroll focused to visible area
-                    lv_page_focus(page, lv_group_get_focused(app_data.group), true);
+                    page_scroll_focus(page, lv_group_get_focused(app_data.group));
                     return;
 
                 case LV_KEY_DOWN:
@@ -270,7 +262,7 @@ static void screen_settings_menu_item_cb(lv_obj_t * item, lv_event_t e)
 
                     lv_group_focus_next(app_data.group);
                     // Scroll focused to visible area
-                    lv_page_focus(page, lv_group_get_focused(app_data.group), true);
+                    page_scroll_focus(page, lv_group_get_focused(app_data.group));
                     return;
 
                 // Value change
@@ -304,8 +296,8 @@ static void screen_settings_menu_item_cb(lv_obj_t * item, lv_event_t e)
             }
             return;
 
-        // injected event from hacked driver
-        case HACK_EVENT_RELEASED:
+        // release of other keys, from keypad driver
+        case APP_EVENT_KEY_RELEASED:
             skip_cnt = 0;
 
             switch (key_code)
@@ -347,6 +339,7 @@ void screen_settings_create()
         lv_obj_get_height(lv_scr_act()) - LIST_MARGIN_TOP
     );
     lv_obj_set_pos(page, 0, LIST_MARGIN_TOP);
+    page_scroll_attach(page);
 
     lv_obj_t * selected_item = NULL;
     uint8_t selected_id = (uint8_t)app_data.screen_settings_selected_id;
@@ -416,5 +409,6 @@ void screen_settings_destroy()
     lv_group_set_focus_cb(app_data.group, NULL);
     lv_group_set_style_mod_cb(app_data.group, NULL);
     lv_group_remove_all_objs(app_data.group);
+    page_scroll_detach();
     lv_obj_clean(lv_scr_act());
 }
@@ -0,0 +1,172 @@
+#ifndef __SETTINGS__
+#define __SETTINGS__
+
+// Persistent settings, described by schema - tuple of typed descriptors.
+// Each entry binds eeprom address to variable, with default value & bounds
+// of the same type. Load & save code is generated per entry at compile time,
+// so wrong value type or bounds don't compile. To add new setting - add
+// single `SETTING()` line to schema.
+//
+// Store remembers last loaded/saved values, and writes only changed ones.
+
+#include <stdint.h>
+#include <math.h>
+#include <tuple>
+
+template <typename T>
+struct Setting
+{
+    uint16_t addr;
+    T * ref;
+    T dflt;
+    T min;
+    T max;
+};
+
+// Address MUST never change. Don't reuse addresses of removed settings.
+// Braces reject narrowing, e.g. float default for uint8_t variable.
+#define SETTING(ADDR, VAR, DFLT, MIN, MAX) \
+    Setting<decltype(VAR)>{ ADDR, &(VAR), DFLT, MIN, MAX }
+
+
+// Raw eeprom value <-> typed value
+template <typename T> struct SettingCodec;
+
+template <> struct SettingCodec<float>
+{
+    static uint32_t to_raw(float val)
+    {
+        union { uint32_t i; float f; } x;
+        x.f = val;
+        return x.i;
+    }
+
+    static float from_raw(uint32_t raw)
+    {
+        union { uint32_t i; float f; } x;
+        x.i = raw;
+        return x.f;
+    }
+
+    static bool valid(float val) { return !isnan(val); }
+};
+
+template <> struct SettingCodec<bool>
+{
+    static uint32_t to_raw(bool val) { return val ? 1 : 0; }
+    static bool from_raw(uint32_t raw) { return raw != 0; }
+    static bool valid(bool) { return true; }
+};
+
+template <> struct SettingCodec<uint8_t>
+{
+    static uint32_t to_raw(uint8_t val) { return val; }
+    // Out of range values are clamped, not truncated
+    static uint8_t from_raw(uint32_t raw) { return raw > UINT8_MAX ? UINT8_MAX : (uint8_t)raw; }
+    static bool valid(uint8_t) { return true; }
+};
+
+
+template <typename EEPROM, typename SCHEMA>
+class SettingsStore
+{
+    static const uint8_t COUNT = std::tuple_size<SCHEMA>::value;
+
+    static_assert(COUNT <= (uint8_t)EEPROM::MAX_BATCH_SIZE, "Too many settings for single batch");
+
+    EEPROM & eeprom;
+    const SCHEMA & schema;
+
+    // Values, known to be in eeprom
+    uint32_t stored[COUNT];
+
+    template <typename T>
+    static uint32_t get_raw(const Setting<T> & s) { return SettingCodec<T>::to_raw(*s.ref); }
+
+    template <typename T>
+    static uint32_t dflt_raw(const Setting<T> & s) { return SettingCodec<T>::to_raw(s.dflt); }
+
+    // Restore value with bounds check, to survive broken or outdated data
+    template <typename T>
+    static void set_raw(const Setting<T> & s, uint32_t raw)
+    {
+        T val = SettingCodec<T>::from_raw(raw);
+
+        if (!SettingCodec<T>::valid(val)) val = s.dflt;
+        if (val < s.min) val = s.min;
+        if (val > s.max) val = s.max;
+
+        *s.ref = val;
+    }
+
+    // Compile-time loop over schema entries
+    template <uint8_t I = 0, typename FN>
+    typename std::enable_if<(I < COUNT)>::type each(FN fn)
+    {
+        fn(I, std::get<I>(schema));
+        each<I + 1>(fn);
+    }
+
+    template <uint8_t I, typename FN>
+    typename std::enable_if<(I >= COUNT)>::type each(FN) {}
+
+public:
+    SettingsStore(EEPROM & _eeprom, const SCHEMA & _schema)
+        : eeprom(_eeprom), schema(_schema) {}
+
+    // Read all values with single eeprom scan
+    void load()
+    {
+        typename EEPROM::Item items[COUNT];
+
+        each([&](uint8_t i, const auto & s) {
+            items[i] = EEPROM::item_u32(s.addr, dflt_raw(s));
+        });
+
+        eeprom.read_batch(items, COUNT);
+
+        each([&](uint8_t i, const auto & s) {
+            stored[i] = items[i].value;
+            set_raw(s, items[i].value);
+        });
+    }
+
+    // Number of values, changed since last load/save
+    uint8_t pending()
+    {
+        uint8_t count = 0;
+
+        each([&](uint8_t i, const auto & s) {
+            if (get_raw(s) != stored[i]) count++;
+        });
+
+        return count;
+    }
+
+    // Write changed values only, as single atomic group. On failure values
+    // stay pending, to retry later.
+    bool save()
+    {
+        typename EEPROM::Item items[COUNT];
+        uint8_t idx[COUNT];
+        uint8_t count = 0;
+
+        each([&](uint8_t i, const auto & s) {
+            uint32_t raw = get_raw(s);
+
+            if (raw == stored[i]) return;
+
+            idx[count] = i;
+            items[count++] = EEPROM::item_u32(s.addr, raw);
+        });
+
+        if (!count) return true;
+        if (!eeprom.write_batch(items, count)) return false;
+
+        for (uint8_t i = 0; i < count; i++) stored[idx[i]] = items[i].value;
+
+        return true;
+    }
+};
+
+#endif
@@ -54,7 +54,7 @@ class Stepper {
 
     void process_input()
     {
-        if (pending_request) return;
+        if (!pending_request) return;
 
         // Ignore everyhing been before, start from the begining
         uint16_t r = pending_request;
@@ -82,7 +82,7 @@ class Stepper {
 public:
     Stepper(StepperPwmParams * _params) : params(_params) {}
 
-    void go(uint8_t phase) { pending_request = phase & REQUEST_MOVE_FLAG; }
+    void go(uint8_t phase) { pending_request = phase | REQUEST_MOVE_FLAG; }
 
     void off() { pending_request = REQUEST_OFF_FLAG; }
 
@@ -91,6 +91,7 @@ public:
     // can be used from interrupts
     void tick()
     {
+        process_input();
 
         switch (state)
         {
@@ -26,7 +26,9 @@ class StepperControl
         STATE_DOSE,
         STATE_DOSE_RETRACT
 
-    } state = STATE_STOPPED;
+    };
+
+    volatile State state = STATE_STOPPED;
 
     enum Cmd {
         CMD_NONE = 0,
@@ -57,7 +59,7 @@ class StepperControl
 
     void step_prev()
     {
-        current_stepper_phase++;
+        current_stepper_phase--;
         stepper.go(current_stepper_phase);
     }
 
@@ -72,6 +74,8 @@ class StepperControl
 
     void process_commands()
     {
+        if (pending_cmd == CMD_NONE) return;
+
         switch (pending_cmd)
         {
         case CMD_FAST_FORWARD:
@@ -162,7 +166,7 @@ class StepperControl
 
             case STATE_FLOW:
                 // Jump to dose directly, skip retracts
-                to_state(STATE_FLOW);
+                to_state(STATE_DOSE);
                 dose_count = dose_steps;
                 break;
 
@@ -219,6 +223,9 @@ public:
     void fast_back() { pending_cmd = CMD_FAST_BACK; };
     void dose() { pending_cmd = CMD_DOSE; };
 
+    // Motor stopped and no commands waiting. Safe to stall CPU (flash writes).
+    bool is_idle() { return state == STATE_STOPPED && pending_cmd == CMD_NONE; }
+
     void tick() {
         process_commands();
 
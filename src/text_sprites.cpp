@@ -0,0 +1,119 @@
+#include "text_sprites.h"
+
+#include <string.h>
+
+static const text_sprite_t * text_sprite_find(const lv_font_t * font, const char * text)
+{
+    for (const text_sprite_t * s = text_sprites; s->font; s++)
+    {
+        if (s->font == font && !strcmp(s->text, text)) return s;
+    }
+
+    return NULL;
+}
+
+// Blend sprite into display buffer, with the same math as subpixel letters
+// drawing in LVGL.
+static void text_sprite_blit(
+    const text_sprite_t * s,
+    lv_coord_t x,
+    lv_coord_t y,
+    const lv_area_t * clip,
+    lv_color_t color,
+    lv_opa_t opa)
+{
+    lv_disp_buf_t * vdb = lv_disp_get_buf(lv_refr_get_disp_refreshing());
+    lv_coord_t vdb_width = lv_area_get_width(&vdb->area);
+    const uint8_t * p = s->data;
+
+    for (lv_coord_t py = y; py < y + s->height && py <= clip->y2; py++)
+    {
+        uint8_t spans = *p++;
+
+        for (uint8_t i = 0; i < spans; i++)
+        {
+            lv_coord_t sx = x + p[0];
+            uint8_t len = p[1];
+            const uint8_t * alpha = p + 2;
+
+            p += 2 + (len * 3 + 1) / 2;
+
+            if (py < clip->y1) continue;
+
+            lv_coord_t from = LV_MATH_MAX(sx, clip->x1);
+            lv_coord_t to = LV_MATH_MIN(sx + len - 1, clip->x2);
+            lv_color_t * dst = vdb->buf_act + (py - vdb->area.y1) * vdb_width + (from - vdb->area.x1);
+            uint16_t n = (from - sx) * 3;
+
+            for (lv_coord_t px = from; px <= to; px++, dst++)
+            {
+                uint8_t a[3];
+
+                for (uint8_t c = 0; c < 3; c++, n++)
+                {
+                    uint8_t b = alpha[n >> 1];
+                    a[c] = ((n & 1) ? (b & 0x0F) : (b >> 4)) * 17;
+                    if (opa < LV_OPA_MAX) a[c] = (uint16_t)a[c] * opa >> 8;
+                }
+
+                if (!(a[0] | a[1] | a[2])) continue;
+
+#if LV_FONT_SUBPX_BGR
+                uint8_t tmp = a[0]; a[0] = a[2]; a[2] = tmp;
+#endif
+
+                dst->ch.red = ((uint16_t)color.ch.red * a[0] + (uint16_t)dst->ch.red * (255 - a[0])) >> 8;
+                dst->ch.green = ((uint16_t)color.ch.green * a[1] + (uint16_t)dst->ch.green * (255 - a[1])) >> 8;
+                dst->ch.blue = ((uint16_t)color.ch.blue * a[2] + (uint16_t)dst->ch.blue * (255 - a[2])) >> 8;
+            }
+        }
+    }
+}
+
+void text_sprite_draw(
+    lv_obj_t * obj,
+    const lv_area_t * mask,
+    const lv_style_t * style,
+    const char * text,
+    lv_point_t * pos)
+{
+    lv_opa_t opa_scale = lv_obj_get_opa_scale(obj);
+    const text_sprite_t * s = NULL;
+
+    // Sprites are built without letter space
+    if (style->text.letter_space == 0) s = text_sprite_find(style->text.font, text);
+
+    if (!s)
+    {
+        lv_draw_label(
+            &obj->coords,
+            mask,
+            style,
+            opa_scale,
+            text,
+            LV_TXT_FLAG_NONE,
+            pos,
+            NULL,
+            NULL,
+            lv_obj_get_base_dir(obj)
+        );
+        return;
+    }
+
+    lv_area_t clip;
+    if (!lv_area_intersect(&clip, mask, &obj->coords)) return;
+
+    lv_opa_t opa = opa_scale == LV_OPA_COVER ?
+        style->text.opa : (uint16_t)style->text.opa * opa_scale >> 8;
+
+    if (opa < LV_OPA_MIN) return;
+
+    text_sprite_blit(
+        s,
+        obj->coords.x1 + pos->x + s->ofs_x,
+        obj->coords.y1 + pos->y + s->ofs_y,
+        &clip,
+        style->text.color,
+        opa
+    );
+}
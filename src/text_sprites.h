@@ -0,0 +1,51 @@
+#ifndef __TEXT_SPRITES__
+#define __TEXT_SPRITES__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pre-rendered static strings. Data is generated by
+// `support/build_sprites.js` from font sources, into
+// `fonts/text_sprites.c`.
+//
+// Sprite keeps 4-bpp alpha of each subpixel (3 per pixel). Each row is a
+// list of ink spans: [ count ] ([ x ] [ length ] [ alpha nibbles ])...,
+// position & length in pixels. Color comes from style at runtime.
+
+#include "lvgl.h"
+#include "fonts_custom.h"
+
+// Set 0 to save flash (~12K), strings will be drawn glyph by glyph
+#ifndef TEXT_SPRITES
+#define TEXT_SPRITES 1
+#endif
+
+typedef struct {
+    const lv_font_t * font;
+    const char * text;
+    // Sprite position relative to text position (top left of line)
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t width;
+    uint8_t height;
+    const uint8_t * data;
+} text_sprite_t;
+
+// Terminated with NULL font
+extern const text_sprite_t text_sprites[];
+
+// Draw single line text inside object, like `lv_draw_label()` without
+// flags. If text has pre-rendered sprite, it is blitted directly to display
+// buffer.
+void text_sprite_draw(
+    lv_obj_t * obj,
+    const lv_area_t * mask,
+    const lv_style_t * style,
+    const char * text,
+    lv_point_t * pos
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,322 @@
+#! /usr/bin/env node
+
+// Pre-render static strings into text sprites, to blit those instead of
+// glyph by glyph drawing. Glyphs are taken from generated font sources, and
+// placed the same way as `lv_draw_label()` does (advance, kerning, baseline).
+//
+// Sprite is 4-bpp alpha for each subpixel (fonts are built with `--lcd`),
+// cropped to ink bounds and split to spans. Color is applied at runtime, so
+// the same sprite works with any style & background.
+//
+// Run after `build_fonts.js`. Strings, missing here, are drawn as usual.
+
+const path = require('path');
+const fs = require('fs');
+
+const fontsdir = path.join(__dirname, '../src/fonts');
+const out_file = path.join(fontsdir, 'text_sprites.c');
+
+// List item width is 80px, text starts from 4px. Longer strings are
+// wrapped by LVGL, skip those.
+const MAX_WIDTH = 76;
+// Empty pixels between ink, to join spans (span header is 2 bytes)
+const SPAN_GAP = 2;
+
+const sprites = [
+  // Settings titles, `screen_settings.cpp`
+  { font: 'my_font_roboto_14', texts: [ 'Syringe dia', 'Viscosity', 'Flux part', 'Fast move' ] },
+  // Built-in doses, `doses.cpp`
+  { font: 'my_font_roboto_14', texts: [ '0.041 mm³', '0.053 mm³', '0.085 mm³', '0.170 mm³', '0.350 mm³', '0.700 mm³' ] },
+  { font: 'my_font_roboto_12', texts: [ 'chip 0402', 'SOT-23', 'chip 0603', 'chip 0805', 'chip 1206', 'chip 2512' ] }
+];
+
+
+//
+// Font source parser. Supports format, generated by `build_fonts.js` only:
+// 4 bpp, no compression, class kerning.
+//
+
+function numbers(str) {
+  return str.replace(/\/\*[\s\S]*?\*\//g, '')
+    .split(',')
+    .map(s => s.trim())
+    .filter(s => s.length)
+    .map(s => Number(s));
+}
+
+function array(src, name) {
+  const m = src.match(new RegExp(`${name}\\[\\]\\s*=\\s*\\{([\\s\\S]*?)\\};`));
+  if (!m) throw new Error(`Array "${name}" not found`);
+  return numbers(m[1]);
+}
+
+function field(src, name) {
+  const m = src.match(new RegExp(`\\.${name}\\s*=\\s*([^,\\s}]+)`));
+  if (!m) throw new Error(`Field "${name}" not found`);
+  return m[1];
+}
+
+function load_font(name) {
+  const src = fs.readFileSync(path.join(fontsdir, `${name}.c`), 'utf8');
+
+  if (Number(field(src, 'bpp')) !== 4 || Number(field(src, 'bitmap_format')) !== 0 ||
+      !/\.subpx\s*=\s*LV_FONT_SUBPX_HOR/.test(src)) {
+    throw new Error(`${name}: only 4 bpp subpixel fonts without compression are supported`);
+  }
+
+  const font = {
+    name,
+    bitmap: array(src, 'gylph_bitmap'),
+    glyphs: [],
+    cmaps: [],
+    line_height: Number(field(src, 'line_height')),
+    base_line: Number(field(src, 'base_line')),
+    kern: null
+  };
+
+  const dsc_re = /\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}/g;
+  let m;
+
+  while ((m = dsc_re.exec(src)) !== null) {
+    font.glyphs.push({
+      bitmap_index: Number(m[1]),
+      adv_w: Number(m[2]),
+      box_w: Number(m[3]),
+      box_h: Number(m[4]),
+      ofs_x: Number(m[5]),
+      ofs_y: Number(m[6])
+    });
+  }
+
+  const cmaps_src = src.match(/cmaps\[\]\s*=\s*\{([\s\S]*?)\n\};/)[1];
+
+  for (const c of cmaps_src.split(/\},\s*\{/)) {
+    const list = field(c, 'unicode_list');
+    const ofs_list = field(c, 'glyph_id_ofs_list');
+
+    font.cmaps.push({
+      range_start: Number(field(c, 'range_start')),
+      range_length: Number(field(c, 'range_length')),
+      glyph_id_start: Number(field(c, 'glyph_id_start')),
+      unicode_list: list === 'NULL' ? null : array(src, list),
+      ofs_list: ofs_list === 'NULL' ? null : array(src, ofs_list)
+    });
+  }
+
+  if (/kern_classes\s*=\s*1/.test(src)) {
+    font.kern = {
+      left: array(src, 'kern_left_class_mapping'),
+      right: array(src, 'kern_right_class_mapping'),
+      values: array(src, 'kern_class_values'),
+      right_cnt: Number(field(src, 'right_class_cnt')),
+      scale: Number(field(src, 'kern_scale'))
+    };
+  } else if (/kern_pair_values/.test(src)) {
+    throw new Error(`${name}: kerning pairs not supported, use --force-fast-kern-format`);
+  }
+
+  return font;
+}
+
+function glyph_id(font, code) {
+  for (const c of font.cmaps) {
+    const rcp = code - c.range_start;
+
+    if (rcp < 0 || rcp >= c.range_length) continue;
+
+    if (!c.unicode_list) {
+      return c.glyph_id_start + (c.ofs_list ? c.ofs_list[rcp] : rcp);
+    }
+
+    const idx = c.unicode_list.indexOf(rcp);
+    if (idx < 0) continue;
+
+    return c.glyph_id_start + (c.ofs_list ? c.ofs_list[idx] : idx);
+  }
+
+  return 0;
+}
+
+// Advance in px, rounded as `lv_font_get_glyph_dsc_fmt_txt()` does
+function advance(font, gid, gid_next) {
+  let adv_w = font.glyphs[gid].adv_w;
+
+  if (font.kern && gid_next) {
+    const l = font.kern.left[gid];
+    const r = font.kern.right[gid_next];
+
+    if (l > 0 && r > 0) {
+      const kv = font.kern.values[(l - 1) * font.kern.right_cnt + (r - 1)];
+      adv_w += (kv * font.kern.scale) >> 4;
+    }
+  }
+
+  return (adv_w + (1 << 3)) >> 4;
+}
+
+
+//
+// Render
+//
+
+function render(font, text) {
+  const codes = Array.from(text).map(ch => ch.codePointAt(0));
+  const gids = codes.map(code => glyph_id(font, code));
+  const sub = 3;
+
+  if (gids.includes(0)) throw new Error(`${font.name}: no glyph for some chars of "${text}"`);
+
+  // Text width in px, canvas in subpixels. Glyphs can go out of advance, add
+  // margins.
+  let width = 0;
+  gids.forEach((gid, i) => { width += advance(font, gid, gids[i + 1]); });
+
+  if (width > MAX_WIDTH) return null;
+
+  const margin = 4;
+  const cw = (width + margin * 2) * sub;
+  const ch = font.line_height + margin * 2;
+  const canvas = new Uint8Array(cw * ch);
+
+  let pen = 0;
+
+  gids.forEach((gid, i) => {
+    const g = font.glyphs[gid];
+    const gx = (pen + g.ofs_x + margin) * sub;
+    const gy = (font.line_height - font.base_line) - g.box_h - g.ofs_y + margin;
+
+    for (let y = 0; y < g.box_h; y++) {
+      for (let x = 0; x < g.box_w; x++) {
+        const n = y * g.box_w + x;
+        const byte = font.bitmap[g.bitmap_index + (n >> 1)];
+        const a = (n & 1) ? byte & 0x0F : byte >> 4;
+
+        if (!a) continue;
+
+        // Overlapping glyphs blend, as sequential draw does
+        const p = (gy + y) * cw + gx + x;
+        canvas[p] = canvas[p] + a - Math.round(canvas[p] * a / 15);
+      }
+    }
+
+    pen += advance(font, gid, gids[i + 1]);
+  });
+
+  // Crop to ink, by whole pixels
+  let x1 = Infinity, y1 = Infinity, x2 = -1, y2 = -1;
+
+  for (let y = 0; y < ch; y++) {
+    for (let x = 0; x < cw; x++) {
+      if (!canvas[y * cw + x]) continue;
+      const px = Math.floor(x / sub);
+      x1 = Math.min(x1, px); x2 = Math.max(x2, px);
+      y1 = Math.min(y1, y); y2 = Math.max(y2, y);
+    }
+  }
+
+  if (x2 < 0) return null;
+
+  const w = x2 - x1 + 1;
+  const h = y2 - y1 + 1;
+  const data = [];
+
+  // Rows are lists of ink spans, to skip empty space without checks:
+  // [ spans count ] ([ x ] [ length ] [ alpha nibbles ])...
+  // Position & length are in pixels. Short gaps are kept inside spans.
+  const ink = (y, px) => {
+    for (let i = 0; i < sub; i++) if (canvas[y * cw + (x1 + px) * sub + i]) return true;
+    return false;
+  };
+
+  for (let y = y1; y <= y2; y++) {
+    const spans = [];
+
+    for (let px = 0; px < w; px++) {
+      if (!ink(y, px)) continue;
+
+      const last = spans[spans.length - 1];
+
+      if (last && px - last.end <= SPAN_GAP) last.end = px + 1;
+      else spans.push({ x: px, end: px + 1 });
+    }
+
+    data.push(spans.length);
+
+    for (const span of spans) {
+      const len = span.end - span.x;
+      const nibbles = new Array(Math.ceil(len * sub / 2)).fill(0);
+
+      for (let n = 0; n < len * sub; n++) {
+        const a = canvas[y * cw + (x1 + span.x) * sub + n];
+        nibbles[n >> 1] |= (n & 1) ? a : a << 4;
+      }
+
+      data.push(span.x, len, ...nibbles);
+    }
+  }
+
+  return { ofs_x: x1 - margin, ofs_y: y1 - margin, width: w, height: h, data };
+}
+
+
+//
+// Output
+//
+
+function c_string(str) {
+  return '"' + str.replace(/\\/g, '\\\\').replace(/"/g, '\\"') + '"';
+}
+
+let bitmaps = '';
+let table = '';
+let total = 0;
+let idx = 0;
+
+for (const group of sprites) {
+  const font = load_font(group.font);
+
+  for (const text of group.texts) {
+    const s = render(font, text);
+
+    if (!s) {
+      console.log(`  skip "${text}": too wide or empty`);
+      continue;
+    }
+
+    let bytes = '';
+    for (let i = 0; i < s.data.length; i += 8) {
+      bytes += '    ' + s.data.slice(i, i + 8).map(b => '0x' + b.toString(16)).join(', ') + ',\n';
+    }
+
+    bitmaps += `/* ${c_string(text)}, ${group.font} */\n`;
+    bitmaps += `static LV_ATTRIBUTE_LARGE_CONST const uint8_t sprite_${idx}[] = {\n${bytes}};\n\n`;
+
+    table += `    { .font = &${group.font}, .text = ${c_string(text)}, ` +
+      `.ofs_x = ${s.ofs_x}, .ofs_y = ${s.ofs_y}, .width = ${s.width}, .height = ${s.height}, ` +
+      `.data = sprite_${idx} },\n`;
+
+    total += s.data.length;
+    idx++;
+  }
+}
+
+const out = `#include "text_sprites.h"
+
+/*******************************************************************************
+ * Generated by support/build_sprites.js, do not edit.
+ * Sprites: ${idx}, data: ${total} bytes
+ ******************************************************************************/
+
+#if TEXT_SPRITES
+
+${bitmaps}#endif
+
+const text_sprite_t text_sprites[] = {
+#if TEXT_SPRITES
+${table}#endif
+    { .font = NULL, .text = NULL, .ofs_x = 0, .ofs_y = 0, .width = 0, .height = 0, .data = NULL }
+};
+`;
+
+console.log(`Build ${out_file}`);
+fs.writeFileSync(out_file, out);
@@ -0,0 +1,47 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "backlight.h"
+
+void test_gamma_ends()
+{
+    TEST_ASSERT_EQUAL(0, backlight_gamma(0));
+    TEST_ASSERT_EQUAL(BACKLIGHT_DUTY_MAX, backlight_gamma(BACKLIGHT_LEVEL_MAX));
+    TEST_ASSERT_EQUAL(BACKLIGHT_DUTY_MAX, backlight_gamma(BACKLIGHT_LEVEL_MAX + 100));
+}
+
+void test_gamma_monotonic()
+{
+    uint16_t prev = 0;
+
+    for (uint16_t level = 1; level <= BACKLIGHT_LEVEL_MAX; level++)
+    {
+        uint16_t duty = backlight_gamma(level);
+
+        TEST_ASSERT_TRUE(duty >= prev);
+        prev = duty;
+    }
+}
+
+// Perceptual half is ~22% of duty, 1% is still visible
+void test_gamma_curve()
+{
+    uint16_t half = backlight_gamma(50 << 8);
+
+    TEST_ASSERT_UINT_WITHIN(500, 14263, half);
+    TEST_ASSERT_TRUE(backlight_gamma(1 << 8) > 0);
+    TEST_ASSERT_TRUE(backlight_gamma(1 << 8) < backlight_gamma(2 << 8));
+}
+
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_gamma_ends);
+    RUN_TEST(test_gamma_monotonic);
+    RUN_TEST(test_gamma_curve);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "display_scroll.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+// Screen of list pages: header 24 rows, list till the bottom
+enum { TOP = 24, HEIGHT = 136, ROWS = 160, LIST_ROWS = 500 };
+
+// Frame memory emulation, one pixel per row is enough
+static uint16_t gram[ROWS];
+static uint32_t rows_sent;
+
+// Content of screen row, when list is scrolled to `pos`
+static uint16_t content(int16_t y, int16_t pos)
+{
+    if (y < TOP) return (uint16_t)(0xF000 + y);
+    return (uint16_t)(pos + y - TOP);
+}
+
+// Write rows [y1, y2] as display driver does, by continuous memory runs
+static void flush(DisplayScroll & ds, int16_t y1, int16_t y2, int16_t pos)
+{
+    for (int16_t y = y1; y <= y2;)
+    {
+        int16_t len = ds.run(y, y2);
+        int16_t row = ds.map(y);
+
+        TEST_ASSERT_TRUE(len > 0);
+
+        for (int16_t i = 0; i < len; i++) gram[row + i] = content((int16_t)(y + i), pos);
+
+        rows_sent += len;
+        y += len;
+    }
+}
+
+// Check what panel shows
+static void check(DisplayScroll & ds, int16_t pos)
+{
+    for (int16_t y = 0; y < ROWS; y++)
+    {
+        TEST_ASSERT_EQUAL(content(y, pos), gram[ds.map(y)]);
+    }
+}
+
+
+void test_disabled_is_identity()
+{
+    DisplayScroll ds;
+
+    ds.scroll(10);
+
+    for (int16_t y = 0; y < ROWS; y++) TEST_ASSERT_EQUAL(y, ds.map(y));
+    TEST_ASSERT_EQUAL(ROWS, ds.run(0, ROWS - 1));
+}
+
+void test_map_and_run()
+{
+    DisplayScroll ds;
+    ds.set_area(TOP, HEIGHT);
+
+    // Content moves up by 10 rows
+    ds.scroll(-10);
+
+    TEST_ASSERT_EQUAL(10, ds.offset);
+    TEST_ASSERT_EQUAL(23, ds.map(23));
+    TEST_ASSERT_EQUAL(34, ds.map(24));
+    TEST_ASSERT_EQUAL(24, ds.map(150));
+    TEST_ASSERT_EQUAL(33, ds.map(159));
+
+    // Strip crossing header & band is split at band top
+    TEST_ASSERT_EQUAL(4, ds.run(20, 29));
+    // Band is split at memory wrap
+    TEST_ASSERT_EQUAL(126, ds.run(24, 159));
+    TEST_ASSERT_EQUAL(10, ds.run(150, 159));
+
+    // Full turn is the same as no scroll
+    ds.scroll(-(HEIGHT - 10));
+    TEST_ASSERT_EQUAL(0, ds.offset);
+    TEST_ASSERT_EQUAL(HEIGHT, ds.run(24, 159));
+}
+
+// Random list navigation, only exposed rows are redrawn
+void test_scroll_redraw_exposed_only()
+{
+    DisplayScroll ds;
+    int16_t pos = 200;
+    uint32_t full_rows = 0;
+
+    ds.set_area(TOP, HEIGHT);
+    flush(ds, 0, ROWS - 1, pos);
+    check(ds, pos);
+
+    srand(1);
+    rows_sent = 0;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        int16_t dy = (int16_t)(rand() % 81 - 40);
+
+        if (pos - dy < 0 || pos - dy > LIST_ROWS) continue;
+
+        pos = (int16_t)(pos - dy);
+        ds.scroll(dy);
+
+        if (dy > 0) flush(ds, TOP, (int16_t)(TOP + dy - 1), pos);
+        if (dy < 0) flush(ds, (int16_t)(TOP + HEIGHT + dy), TOP + HEIGHT - 1, pos);
+
+        check(ds, pos);
+        if (dy) full_rows += HEIGHT;
+    }
+
+    // Average shift is ~20 rows of 136
+    TEST_ASSERT_TRUE(rows_sent * 5 < full_rows);
+}
+
+void test_set_area_resets_shift()
+{
+    DisplayScroll ds;
+
+    ds.set_area(TOP, HEIGHT);
+    ds.scroll(7);
+    ds.set_area(TOP, HEIGHT);
+
+    TEST_ASSERT_EQUAL(0, ds.offset);
+    TEST_ASSERT_EQUAL(TOP, ds.map(TOP));
+
+    ds.set_area(0, 0);
+    TEST_ASSERT_FALSE(ds.enabled());
+}
+
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_disabled_is_identity);
+    RUN_TEST(test_map_and_run);
+    RUN_TEST(test_scroll_redraw_exposed_only);
+    RUN_TEST(test_set_area_resets_shift);
+    return UNITY_END();
+}
+
+#endif
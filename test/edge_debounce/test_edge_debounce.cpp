@@ -0,0 +1,78 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "edge_debounce.h"
+
+enum { LOCKOUT = 10 };
+
+void test_press_is_instant()
+{
+    EdgeDebounce key(LOCKOUT);
+
+    TEST_ASSERT_FALSE(key.tick(false));
+    TEST_ASSERT_TRUE(key.edge(true));
+    TEST_ASSERT_TRUE(key.is_set());
+}
+
+void test_bounce_is_ignored()
+{
+    EdgeDebounce key(LOCKOUT);
+
+    key.edge(true);
+
+    // Contacts bounce, state is kept
+    for (int i = 0; i < LOCKOUT - 1; i++)
+    {
+        TEST_ASSERT_FALSE(key.edge(i & 1));
+        TEST_ASSERT_FALSE(key.tick(i & 1));
+        TEST_ASSERT_TRUE(key.is_set());
+    }
+
+    // Stable after lockout
+    TEST_ASSERT_FALSE(key.tick(true));
+    TEST_ASSERT_TRUE(key.is_set());
+
+    TEST_ASSERT_TRUE(key.edge(false));
+    TEST_ASSERT_FALSE(key.is_set());
+}
+
+// Short press, released during lockout, is caught after it
+void test_release_in_lockout()
+{
+    EdgeDebounce key(LOCKOUT);
+
+    key.edge(true);
+    key.edge(false);
+
+    for (int i = 0; i < LOCKOUT - 1; i++) TEST_ASSERT_FALSE(key.tick(false));
+
+    TEST_ASSERT_TRUE(key.tick(false));
+    TEST_ASSERT_FALSE(key.is_set());
+}
+
+// Without interrupts, ticks work as polling debouncer
+void test_polling_only()
+{
+    EdgeDebounce key(LOCKOUT);
+
+    TEST_ASSERT_TRUE(key.tick(true));
+
+    for (int i = 0; i < LOCKOUT - 1; i++) TEST_ASSERT_FALSE(key.tick(false));
+
+    TEST_ASSERT_TRUE(key.tick(false));
+    TEST_ASSERT_FALSE(key.is_set());
+}
+
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_press_is_instant);
+    RUN_TEST(test_bounce_is_ignored);
+    RUN_TEST(test_release_in_lockout);
+    RUN_TEST(test_polling_only);
+    return UNITY_END();
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "eeprom_emu.h"
 #include "eeprom_flash_driver.h"
+#include "eeprom_flash_driver_mock.h"
 
 
 #include <stdio.h>
@@ -32,7 +33,7 @@ void test_eeprom_write() {
     eeprom.write_u32(3, 0x0000AA99);
     // bank Marker + address + value
     uint8_t expected[] = {
-        0xEE, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
         0xAA, 0x55,                 // commit mark
         0x03, 0x00,                 // addr
         0x99, 0xAA, 0x00, 0x00,     // data
@@ -48,7 +49,7 @@ void test_eeprom_write_over() {
     eeprom.write_u32(3, 0x5577CCEE);
 
     uint8_t expected[] = {
-        0xEE, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
         0xAA, 0x55,                 // commit mark
         0x03, 0x00,                 // addr
         0x99, 0xAA, 0x00, 0x00,     // data
@@ -69,7 +70,7 @@ void test_eeprom_write_skip_the_same() {
 
     // Only 2 records should exist (1 old + 1 new)
     uint8_t expected[] = {
-        0xEE, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
         0xAA, 0x55,                 // commit mark
         0x03, 0x00,                 // addr
         0x99, 0xAA, 0x00, 0x00,     // data
@@ -119,7 +120,7 @@ void test_eeprom_bank_move() {
 
     // New bank should contain only 2 records
     uint8_t expected[] = {
-        0xEE, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xEE, 0x77, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header, generation 1
         0xAA, 0x55,                 // commit mark
         0x07, 0x00,                 // addr
         0x00, 0x00, 0x00, 0x00,     // data
@@ -140,6 +141,284 @@ void test_eeprom_float() {
     TEST_ASSERT_EQUAL_HEX32(0.44F, eeprom.read_float(3, 0.0F));
 }
 
+void test_eeprom_batch_write() {
+    EepromEmu<EepromFlashDriver> eeprom;
+    typedef EepromEmu<EepromFlashDriver> Eeprom;
+
+    const Eeprom::Item items[] = {
+        Eeprom::item_u32(3, 0x0000AA99),
+        Eeprom::item_u32(5, 0x5577CCEE)
+    };
+    eeprom.write_batch(items, 2);
+
+    uint8_t expected[] = {
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0x5A, 0x5A,                 // group member mark
+        0x03, 0x00,                 // addr
+        0x99, 0xAA, 0x00, 0x00,     // data
+        0x01, 0xA5,                 // group commit mark (1 member before)
+        0x05, 0x00,                 // addr
+        0xEE, 0xCC, 0x77, 0x55,     // data
+        0xFF // free space start
+    };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, eeprom.flash.memory, sizeof(expected));
+
+    TEST_ASSERT_EQUAL_HEX32(0x0000AA99, eeprom.read_u32(3, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x5577CCEE, eeprom.read_u32(5, 0));
+}
+
+void test_eeprom_batch_skip_the_same() {
+    EepromEmu<EepromFlashDriver> eeprom;
+    typedef EepromEmu<EepromFlashDriver> Eeprom;
+
+    eeprom.write_u32(3, 0x0000AA99);
+
+    const Eeprom::Item items[] = {
+        Eeprom::item_u32(3, 0x0000AA99),
+        Eeprom::item_u32(5, 0x5577CCEE)
+    };
+    eeprom.write_batch(items, 2);
+    eeprom.write_batch(items, 2);
+
+    // Single changed value is written as ordinary record
+    uint8_t expected[] = {
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xAA, 0x55,                 // commit mark
+        0x03, 0x00,                 // addr
+        0x99, 0xAA, 0x00, 0x00,     // data
+        0xAA, 0x55,                 // commit mark
+        0x05, 0x00,                 // addr
+        0xEE, 0xCC, 0x77, 0x55,     // data
+        0xFF // free space start
+    };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, eeprom.flash.memory, sizeof(expected));
+}
+
+void test_eeprom_batch_broken() {
+    EepromEmu<EepromFlashDriver> eeprom;
+    typedef EepromEmu<EepromFlashDriver> Eeprom;
+
+    eeprom.write_u32(3, 1);
+
+    const Eeprom::Item items[] = {
+        Eeprom::item_u32(3, 2),
+        Eeprom::item_u32(5, 2)
+    };
+    eeprom.write_batch(items, 2);
+
+    // Emulate power loss before group commit
+    eeprom.flash.memory[24] = 0xFF;
+    eeprom.flash.memory[25] = 0xFF;
+
+    EepromEmu<EepromFlashDriver> eeprom2;
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+    }
+
+    TEST_ASSERT_EQUAL_HEX32(1, eeprom2.read_u32(3, 0));
+    TEST_ASSERT_EQUAL_HEX32(0, eeprom2.read_u32(5, 0));
+
+    // Leftovers of broken group should not become visible after new writes
+    eeprom2.write_u32(7, 7);
+    const Eeprom::Item items2[] = {
+        Eeprom::item_u32(7, 8),
+        Eeprom::item_u32(9, 9)
+    };
+    eeprom2.write_batch(items2, 2);
+
+    TEST_ASSERT_EQUAL_HEX32(1, eeprom2.read_u32(3, 0));
+    TEST_ASSERT_EQUAL_HEX32(0, eeprom2.read_u32(5, 0));
+    TEST_ASSERT_EQUAL_HEX32(8, eeprom2.read_u32(7, 0));
+    TEST_ASSERT_EQUAL_HEX32(9, eeprom2.read_u32(9, 0));
+}
+
+void test_eeprom_batch_bank_move() {
+    EepromEmu<EepromFlashDriver> eeprom;
+    typedef EepromEmu<EepromFlashDriver> Eeprom;
+
+    uint32_t data = 0x7777CCCC;
+
+    // Write enough groups to overflow bank few times
+    for (int i = 0; i < 300; i++)
+    {
+        const Eeprom::Item items[] = {
+            Eeprom::item_u32(1, data),
+            Eeprom::item_u32(2, data + 1),
+            Eeprom::item_u32(3, data + 2)
+        };
+        eeprom.write_batch(items, 3);
+        data ^= 0xFFFFFFFF;
+    }
+
+    data ^= 0xFFFFFFFF;
+    TEST_ASSERT_EQUAL_HEX32(data, eeprom.read_u32(1, 0));
+    TEST_ASSERT_EQUAL_HEX32(data + 1, eeprom.read_u32(2, 0));
+    TEST_ASSERT_EQUAL_HEX32(data + 2, eeprom.read_u32(3, 0));
+}
+
+
+void test_eeprom_word_write() {
+    EepromEmu<EepromFlashDriverMock<4>> eeprom;
+
+    eeprom.write_u32(3, 0x0000AA99);
+
+    // Layout is the same as for halfwords
+    uint8_t expected[] = {
+        0xEE, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, // Bank header
+        0xAA, 0x55,                 // commit mark
+        0x03, 0x00,                 // addr
+        0x99, 0xAA, 0x00, 0x00,     // data
+        0xFF // free space start
+    };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, eeprom.flash.memory, sizeof(expected));
+    // Bank marker + record
+    TEST_ASSERT_EQUAL(3, eeprom.flash.total().programs);
+}
+
+template <typename DRIVER>
+static uint32_t batch_programs() {
+    EepromEmu<DRIVER> eeprom;
+    typedef EepromEmu<DRIVER> Eeprom;
+
+    eeprom.read_u32(0, 0); // init bank
+    eeprom.flash.reset_stats();
+
+    typename Eeprom::Item items[8];
+    for (int i = 0; i < 8; i++) items[i] = Eeprom::item_u32(i, 100 + i);
+
+    eeprom.write_batch(items, 8);
+    // Unlock once per batch
+    TEST_ASSERT_EQUAL(1, eeprom.flash.unlocks);
+    TEST_ASSERT_EQUAL(0, eeprom.flash.program_errors);
+    return eeprom.flash.total().programs;
+}
+
+void test_eeprom_batch_programs_count() {
+    TEST_ASSERT_EQUAL(32, batch_programs<EepromFlashDriverMock<2>>());
+    TEST_ASSERT_EQUAL(16, batch_programs<EepromFlashDriverMock<4>>());
+}
+
+template <typename DRIVER>
+static void check_bank_moves() {
+    EepromEmu<DRIVER> eeprom;
+    typedef EepromEmu<DRIVER> Eeprom;
+
+    uint32_t data = 0x7777CCCC;
+
+    for (int i = 0; i < 300; i++)
+    {
+        eeprom.write_u32(7, data);
+
+        const typename Eeprom::Item items[] = {
+            Eeprom::item_u32(1, data),
+            Eeprom::item_u32(2, data + 1)
+        };
+        eeprom.write_batch(items, 2);
+        data ^= 0xFFFFFFFF;
+    }
+
+    data ^= 0xFFFFFFFF;
+    TEST_ASSERT_EQUAL_HEX32(data, eeprom.read_u32(7, 0));
+    TEST_ASSERT_EQUAL_HEX32(data, eeprom.read_u32(1, 0));
+    TEST_ASSERT_EQUAL_HEX32(data + 1, eeprom.read_u32(2, 0));
+
+    // Reload from flash
+    EepromEmu<DRIVER> eeprom2;
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+    }
+    TEST_ASSERT_EQUAL_HEX32(data, eeprom2.read_u32(7, 0));
+    TEST_ASSERT_EQUAL_HEX32(data, eeprom2.read_u32(1, 0));
+    TEST_ASSERT_EQUAL_HEX32(data + 1, eeprom2.read_u32(2, 0));
+}
+
+void test_eeprom_units_bank_move() {
+    check_bank_moves<EepromFlashDriverMock<4>>();
+}
+
+
+void test_eeprom_batch_read() {
+    EepromEmu<EepromFlashDriverMock<2>> eeprom;
+    typedef EepromEmu<EepromFlashDriverMock<2>> Eeprom;
+
+    eeprom.write_u32(3, 0x0000AA99);
+    eeprom.write_u32(5, 0x11111111);
+    eeprom.write_u32(3, 0x5577CCEE);
+
+    Eeprom::Item items[] = {
+        Eeprom::item_u32(3, 0),
+        Eeprom::item_u32(4, 0x12345678),
+        Eeprom::item_u32(5, 0)
+    };
+
+    eeprom.flash.reset_stats();
+    eeprom.read_batch(items, 3);
+
+    TEST_ASSERT_EQUAL_HEX32(0x5577CCEE, items[0].value);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, items[1].value); // default
+    TEST_ASSERT_EQUAL_HEX32(0x11111111, items[2].value);
+
+    // Single pass: 3 addresses + mark & data for 2 matched records
+    TEST_ASSERT_EQUAL(3 + 2 * 3, eeprom.flash.total().reads);
+}
+
+
+void test_eeprom_mapped_read() {
+    EepromEmu<EepromFlashDriverMock<2, 1>> eeprom;
+
+    eeprom.write_u32(3, 0x0000AA99);
+    eeprom.write_u32(5, 0x11111111);
+    eeprom.write_u32(3, 0x5577CCEE);
+
+    eeprom.flash.reset_stats();
+
+    TEST_ASSERT_EQUAL_HEX32(0x5577CCEE, eeprom.read_u32(3, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x11111111, eeprom.read_u32(5, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, eeprom.read_u32(4, 0x12345678));
+
+    // Driver is not called for reads
+    TEST_ASSERT_EQUAL(0, eeprom.flash.total().reads);
+}
+
+template <typename DRIVER>
+static void check_telemetry()
+{
+    EepromEmu<DRIVER> eeprom;
+
+    // 3 values, 300 updates => several bank moves
+    for (uint32_t i = 0; i < 300; i++) eeprom.write_u32(i % 3, i);
+
+    auto & stats = eeprom.get_stats();
+
+    TEST_ASSERT_GREATER_THAN(0, stats.generation);
+    TEST_ASSERT_EQUAL(eeprom.flash.total().erases, stats.erases);
+    TEST_ASSERT_EQUAL(eeprom.flash.total().halfwords * 2, stats.user_bytes + stats.compaction_bytes);
+
+    // Generation survives remount
+    EepromEmu<DRIVER> eeprom2;
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+    }
+
+    TEST_ASSERT_EQUAL(stats.generation, eeprom2.get_stats().generation);
+}
+
+void test_eeprom_telemetry() {
+    check_telemetry<EepromFlashDriverMock<2>>();
+    check_telemetry<EepromFlashDriverMock<4>>();
+
+    // Header without generation (old firmware) is still valid
+    EepromEmu<EepromFlashDriver> eeprom;
+    eeprom.flash.write_u16(0, 0, 0x77EE);
+    eeprom.flash.write_u16(0, 8, 0x55AA);
+    eeprom.flash.write_u16(0, 10, 3);
+    eeprom.flash.write_u16(0, 12, 0x1234);
+    eeprom.flash.write_u16(0, 14, 0);
+
+    TEST_ASSERT_EQUAL_HEX32(0x1234, eeprom.read_u32(3, 0));
+    TEST_ASSERT_EQUAL(0, eeprom.get_stats().generation);
+}
+
 
 int main() {
     UNITY_BEGIN();
@@ -149,6 +428,16 @@ int main() {
     RUN_TEST(test_eeprom_read);
     RUN_TEST(test_eeprom_bank_move);
     RUN_TEST(test_eeprom_float);
+    RUN_TEST(test_eeprom_batch_write);
+    RUN_TEST(test_eeprom_batch_skip_the_same);
+    RUN_TEST(test_eeprom_batch_broken);
+    RUN_TEST(test_eeprom_batch_bank_move);
+    RUN_TEST(test_eeprom_word_write);
+    RUN_TEST(test_eeprom_batch_programs_count);
+    RUN_TEST(test_eeprom_units_bank_move);
+    RUN_TEST(test_eeprom_batch_read);
+    RUN_TEST(test_eeprom_mapped_read);
+    RUN_TEST(test_eeprom_telemetry);
     return UNITY_END();
 }
 
@@ -0,0 +1,303 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_mock.h"
+
+#include <string.h>
+
+typedef EepromEmu<EepromFlashDriverMock<2>> Eeprom;
+
+// Collect streamed chunks, check those come in order
+template <typename EEPROM>
+static int32_t read_all(EEPROM & eeprom, uint8_t id, uint8_t * buf)
+{
+    uint32_t next = 0;
+
+    return eeprom.read_blob(id, [&](uint32_t ofs, const uint8_t * data, uint32_t len) {
+        TEST_ASSERT_EQUAL(next, ofs);
+        TEST_ASSERT_TRUE(len > 0 && len <= 4);
+        memcpy(buf + ofs, data, len);
+        next = ofs + len;
+    });
+}
+
+void test_blob_write_read() {
+    Eeprom eeprom;
+    uint8_t data[Eeprom::BLOB_MAX_SIZE];
+    uint8_t buf[Eeprom::BLOB_MAX_SIZE];
+
+    for (uint32_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 7 + 1);
+
+    TEST_ASSERT_EQUAL(-1, eeprom.blob_length(0));
+    TEST_ASSERT_EQUAL(-1, read_all(eeprom, 0, buf));
+
+    // All sizes, including partial last chunk
+    uint32_t sizes[] = { 0, 1, 4, 5, 33, Eeprom::BLOB_MAX_SIZE };
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        TEST_ASSERT_TRUE(eeprom.write_blob(3, data, sizes[s]));
+
+        memset(buf, 0, sizeof(buf));
+        TEST_ASSERT_EQUAL(sizes[s], read_all(eeprom, 3, buf));
+        if (sizes[s]) TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, sizes[s]);
+    }
+
+    // Too big
+    TEST_ASSERT_FALSE(eeprom.write_blob(3, data, Eeprom::BLOB_MAX_SIZE + 1));
+    TEST_ASSERT_FALSE(eeprom.write_blob(Eeprom::BLOB_COUNT, data, 1));
+
+    // Blobs don't overlap with each other & with scalars
+    eeprom.write_u32(0, 0x12345678);
+    TEST_ASSERT_TRUE(eeprom.write_blob(4, (const uint8_t *)"abc", 3));
+    TEST_ASSERT_EQUAL(Eeprom::BLOB_MAX_SIZE, eeprom.blob_length(3));
+    TEST_ASSERT_EQUAL(3, eeprom.blob_length(4));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, eeprom.read_u32(0, 0));
+}
+
+void test_blob_skip_unchanged() {
+    Eeprom eeprom;
+    uint8_t data[40];
+
+    for (uint32_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)i;
+
+    eeprom.write_blob(0, data, sizeof(data));
+
+    // Only one chunk changed => single record
+    data[10] = 0xAA;
+    eeprom.flash.reset_stats();
+    eeprom.write_blob(0, data, sizeof(data));
+    TEST_ASSERT_EQUAL(4, eeprom.flash.total().programs);
+
+    // The same data => nothing written
+    eeprom.flash.reset_stats();
+    eeprom.write_blob(0, data, sizeof(data));
+    TEST_ASSERT_EQUAL(0, eeprom.flash.total().programs);
+}
+
+void test_blob_bank_move() {
+    Eeprom eeprom;
+    uint8_t data[30];
+    uint8_t buf[30];
+
+    for (uint32_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i + 100);
+
+    eeprom.write_blob(1, data, sizeof(data));
+    eeprom.write_blob(2, data, 10);
+
+    // Overflow bank with other writes
+    for (uint32_t i = 0; i < 300; i++) eeprom.write_u32(0, i);
+
+    TEST_ASSERT_GREATER_THAN(0, eeprom.get_stats().generation);
+
+    TEST_ASSERT_EQUAL(sizeof(data), read_all(eeprom, 1, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, sizeof(data));
+
+    TEST_ASSERT_EQUAL(10, read_all(eeprom, 2, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, 10);
+}
+
+void test_blob_power_loss() {
+    typedef EepromEmu<EepromFlashDriverMock<4>> Eeprom4;
+
+    uint8_t old_data[20], new_data[25], buf[25];
+
+    memset(old_data, 0x11, sizeof(old_data));
+    memset(new_data, 0x22, sizeof(new_data));
+
+    // Blob should be old or new, never mixed
+    for (uint32_t cut = 0; cut < 40; cut++)
+    {
+        Eeprom4 eeprom;
+        eeprom.write_blob(0, old_data, sizeof(old_data));
+
+        eeprom.flash.power_cut_after(cut);
+        eeprom.write_blob(0, new_data, sizeof(new_data));
+
+        Eeprom4 eeprom2;
+        for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+            eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+        }
+
+        int32_t len = read_all(eeprom2, 0, buf);
+
+        if (len == sizeof(old_data)) TEST_ASSERT_EQUAL_HEX8_ARRAY(old_data, buf, len);
+        else
+        {
+            TEST_ASSERT_EQUAL(sizeof(new_data), len);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(new_data, buf, len);
+        }
+    }
+}
+
+
+// Records with given address in both banks, including not visible ones
+template <typename EEPROM>
+static uint32_t count_records(EEPROM & eeprom, uint16_t addr)
+{
+    uint32_t n = 0;
+
+    for (uint8_t bank = 0; bank < 2; bank++)
+    {
+        const uint8_t * p = eeprom.flash.bank_ptr(bank);
+
+        for (uint32_t ofs = 8; ofs < EEPROM_EMU_BANK_SIZE; ofs += 8)
+        {
+            if (p[ofs + 2] == (addr & 0xFF) && p[ofs + 3] == (addr >> 8)) n++;
+        }
+    }
+
+    return n;
+}
+
+void test_blob_shrink_deletes_tail() {
+    Eeprom eeprom;
+    uint8_t data[40];
+    uint8_t buf[40];
+
+    for (uint32_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i + 1);
+
+    eeprom.write_blob(0, data, sizeof(data));
+    TEST_ASSERT_TRUE(eeprom.write_blob(0, data, 8));
+
+    TEST_ASSERT_EQUAL(8, read_all(eeprom, 0, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, 8);
+
+    // Trailing chunks should not survive bank move
+    for (uint32_t i = 0; eeprom.get_stats().generation == 0; i++) eeprom.write_u32(0, i);
+
+    for (uint8_t seq = 3; seq <= 10; seq++)
+    {
+        TEST_ASSERT_EQUAL(0, count_records(eeprom, 0x8000 + seq));
+    }
+
+    TEST_ASSERT_EQUAL(8, read_all(eeprom, 0, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, 8);
+
+    // Grow back, deleted chunks are written again
+    data[20] = 0xAA;
+    TEST_ASSERT_TRUE(eeprom.write_blob(0, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(sizeof(data), read_all(eeprom, 0, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, sizeof(data));
+}
+
+void test_blob_no_space() {
+    Eeprom eeprom;
+    uint8_t data[60];
+    uint8_t buf[60];
+
+    memset(data, 0x5A, sizeof(data));
+    eeprom.write_u32(1, 0xABCD);
+
+    // 16 records per blob, bank fits 127
+    uint8_t written = 0;
+
+    while (written < Eeprom::BLOB_COUNT && eeprom.write_blob(written, data, sizeof(data))) written++;
+
+    TEST_ASSERT_EQUAL(7, written);
+    TEST_ASSERT_EQUAL(-1, eeprom.blob_length(written));
+
+    // Existing data still can be updated, and survives bank moves
+    data[0] = 0x11;
+    TEST_ASSERT_TRUE(eeprom.write_blob(0, data, sizeof(data)));
+
+    for (uint32_t i = 0; eeprom.get_stats().generation < 3; i++)
+    {
+        TEST_ASSERT_TRUE(eeprom.write_u32(1, i));
+    }
+
+    TEST_ASSERT_EQUAL(sizeof(data), read_all(eeprom, 0, buf));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, sizeof(data));
+
+    data[0] = 0x5A;
+
+    for (uint8_t id = 1; id < written; id++)
+    {
+        TEST_ASSERT_EQUAL(sizeof(data), read_all(eeprom, id, buf));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(data, buf, sizeof(data));
+    }
+
+    // Shrink frees space for new blob
+    TEST_ASSERT_TRUE(eeprom.write_blob(1, data, 4));
+    TEST_ASSERT_TRUE(eeprom.write_blob(written, data, sizeof(data)));
+}
+
+// Bank, written by old firmware, can have more data than fits into new bank
+// with counters reserve. Move should fail without data loss.
+void test_bank_move_overflow() {
+    typedef EepromEmu<EepromFlashDriverMock<2, 1>, 1> EepromC;
+    EepromC eeprom;
+
+    // 768 bytes for records => 95 records
+    const uint32_t records = (EEPROM_EMU_BANK_SIZE - 256 - 8) / 8;
+    uint16_t * mem = (uint16_t *)eeprom.flash.memory;
+
+    mem[0] = 0x77EE;
+    mem[1] = 0;
+
+    for (uint32_t i = 0; i < records; i++)
+    {
+        uint16_t * r = mem + 4 + i * 4;
+        r[0] = 0x55AA; r[1] = i; r[2] = i; r[3] = 0;
+    }
+
+    // Counter with tally, but without base record
+    mem[(EEPROM_EMU_BANK_SIZE - 256) / 2] = 0;
+
+    TEST_ASSERT_EQUAL(1, eeprom.read_counter(0));
+
+    TEST_ASSERT_FALSE(eeprom.write_u32(0, 1000));
+    TEST_ASSERT_EQUAL(0, eeprom.get_stats().generation);
+    TEST_ASSERT_EQUAL(0, eeprom.get_stats().erases);
+
+    for (uint32_t i = 0; i < records; i++) TEST_ASSERT_EQUAL(i, eeprom.read_u32(i, UINT32_MAX));
+    TEST_ASSERT_EQUAL(1, eeprom.read_counter(0));
+}
+
+void test_blob_shrink_power_loss() {
+    uint8_t old_data[40], new_data[12], buf[40];
+
+    memset(old_data, 0x11, sizeof(old_data));
+    memset(new_data, 0x22, sizeof(new_data));
+
+    for (uint32_t cut = 0; cut < 40; cut++)
+    {
+        Eeprom eeprom;
+        eeprom.write_blob(0, old_data, sizeof(old_data));
+
+        eeprom.flash.power_cut_after(cut);
+        eeprom.write_blob(0, new_data, sizeof(new_data));
+
+        Eeprom eeprom2;
+        for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+            eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+        }
+
+        int32_t len = read_all(eeprom2, 0, buf);
+
+        if (len == sizeof(old_data)) TEST_ASSERT_EQUAL_HEX8_ARRAY(old_data, buf, len);
+        else
+        {
+            TEST_ASSERT_EQUAL(sizeof(new_data), len);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(new_data, buf, len);
+        }
+    }
+}
+
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_blob_write_read);
+    RUN_TEST(test_blob_skip_unchanged);
+    RUN_TEST(test_blob_bank_move);
+    RUN_TEST(test_blob_power_loss);
+    RUN_TEST(test_blob_shrink_deletes_tail);
+    RUN_TEST(test_blob_no_space);
+    RUN_TEST(test_bank_move_overflow);
+    RUN_TEST(test_blob_shrink_power_loss);
+    return UNITY_END();
+}
+
+#endif
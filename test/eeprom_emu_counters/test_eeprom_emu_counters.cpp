@@ -0,0 +1,127 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_mock.h"
+
+#include <stdio.h>
+
+enum { DOSES = 0, SESSIONS = 1 };
+
+
+template <typename EEPROM>
+static void check_counters()
+{
+    EEPROM eeprom;
+
+    TEST_ASSERT_EQUAL(0, eeprom.read_counter(DOSES));
+
+    // Enough to overflow tally and move bank several times
+    for (uint32_t i = 1; i <= 2000; i++)
+    {
+        eeprom.increment_counter(DOSES);
+        if (i % 10 == 0) eeprom.increment_counter(SESSIONS);
+        if (i % 100 == 0) eeprom.increment_counter(SESSIONS, 1000);
+        if (i % 50 == 0) eeprom.write_u32(5, i);
+
+        TEST_ASSERT_EQUAL(i, eeprom.read_counter(DOSES));
+    }
+
+    TEST_ASSERT_EQUAL(200 + 20 * 1000, eeprom.read_counter(SESSIONS));
+    TEST_ASSERT_EQUAL(2000, eeprom.read_u32(5, 0));
+    TEST_ASSERT_EQUAL(0, eeprom.flash.program_errors);
+
+    // Remount
+    EEPROM eeprom2;
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+    }
+
+    TEST_ASSERT_EQUAL(2000, eeprom2.read_counter(DOSES));
+    TEST_ASSERT_EQUAL(200 + 20 * 1000, eeprom2.read_counter(SESSIONS));
+    TEST_ASSERT_EQUAL(2000, eeprom2.read_u32(5, 0));
+}
+
+void test_counters() {
+    check_counters<EepromEmu<EepromFlashDriverMock<2>, 2, 128>>();
+    check_counters<EepromEmu<EepromFlashDriverMock<4>, 2, 128>>();
+    check_counters<EepromEmu<EepromFlashDriverMock<2, 1>, 2, 128>>();
+}
+
+void test_counters_power_loss() {
+    typedef EepromEmu<EepromFlashDriverMock<4>, 1, 64> Eeprom;
+
+    // Cut power at every possible point of increments sequence. Value should
+    // never go back, and should lose no more than interrupted increment.
+    for (uint32_t cut = 0; cut < 600; cut++)
+    {
+        Eeprom eeprom;
+        uint32_t done = 0;
+
+        eeprom.flash.power_cut_after(cut);
+
+        while (!eeprom.flash.power_lost())
+        {
+            eeprom.increment_counter(0);
+            if (!eeprom.flash.power_lost()) done++;
+        }
+
+        Eeprom eeprom2;
+        for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+            eeprom2.flash.memory[i] = eeprom.flash.memory[i];
+        }
+
+        uint32_t val = eeprom2.read_counter(0);
+        TEST_ASSERT_TRUE(val == done || val == done + 1);
+    }
+}
+
+// Year of use: 200 doses per day, settings tuned once a day. Compare
+// counter with plain `write_u32()` increments.
+void test_counters_year() {
+    enum { DAYS = 365, DOSES_PER_DAY = 200 };
+
+    EepromEmu<EepromFlashDriverMock<2>, 1, 512> eeprom;
+    EepromEmu<EepromFlashDriverMock<2>> plain;
+
+    uint32_t plain_value = 0;
+
+    for (uint32_t day = 0; day < DAYS; day++)
+    {
+        for (uint32_t d = 0; d < DOSES_PER_DAY; d++)
+        {
+            eeprom.increment_counter(DOSES);
+            plain.write_u32(100, ++plain_value);
+        }
+
+        eeprom.write_u32(0, day);
+        plain.write_u32(0, day);
+    }
+
+    TEST_ASSERT_EQUAL(DAYS * DOSES_PER_DAY, eeprom.read_counter(DOSES));
+    TEST_ASSERT_EQUAL(DAYS * DOSES_PER_DAY, plain.read_u32(100, 0));
+
+    uint32_t erases = eeprom.flash.total().erases;
+    uint32_t plain_erases = plain.flash.total().erases;
+
+    printf(
+        "  year, %d doses: counter %d erases (%d per bank), write_u32 %d erases (%d per bank)\n",
+        DAYS * DOSES_PER_DAY,
+        (int)erases, (int)(erases / 2),
+        (int)plain_erases, (int)(plain_erases / 2)
+    );
+
+    TEST_ASSERT_LESS_THAN(plain_erases / 2, erases);
+}
+
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_counters);
+    RUN_TEST(test_counters_power_loss);
+    RUN_TEST(test_counters_year);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,183 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_mock.h"
+
+#include <stdio.h>
+#include <chrono>
+
+// Boot-time benchmark. Mount cost should not depend much on bank fill, and
+// loading settings should be a single scan.
+
+typedef EepromFlashDriverMock<2> Driver;
+typedef EepromEmu<Driver> Eeprom;
+
+enum { SETTINGS = 8, CAPACITY = (Driver::BankSize - 8) / 8 };
+
+// Fill bank with `count` records & return flash copy in `eeprom_out`
+static void prepare(Eeprom & eeprom_out, uint32_t count)
+{
+    Eeprom eeprom;
+
+    // Format blank flash first. Full scan happens only here.
+    eeprom.mount();
+
+    for (uint32_t i = 0; i < count; i++) eeprom.write_u32(i % SETTINGS, i);
+
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        eeprom_out.flash.memory[i] = eeprom.flash.memory[i];
+    }
+}
+
+// Reference, linear search of the first empty record in active bank
+static uint32_t linear_frontier(Eeprom & eeprom)
+{
+    uint8_t * m = eeprom.flash.memory;
+    uint32_t bank = 0;
+
+    // Active bank has marker 0x77EE and no dirty mark
+    if (!(m[0] == 0xEE && m[1] == 0x77 && m[4] == 0xFF && m[5] == 0xFF)) bank = 1;
+
+    uint32_t ofs = bank * Driver::BankSize + 8;
+
+    for (; ofs < (bank + 1) * Driver::BankSize; ofs += 8)
+    {
+        bool empty = true;
+
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            if (m[ofs + i] != 0xFF) empty = false;
+        }
+
+        if (empty) break;
+    }
+
+    return ofs;
+}
+
+void test_mount_frontier() {
+    // Full bank is not checked - next write goes to another bank
+    for (uint32_t count = 0; count < CAPACITY; count++)
+    {
+        Eeprom eeprom;
+        prepare(eeprom, count);
+
+        uint32_t expected = linear_frontier(eeprom);
+
+        eeprom.mount();
+        eeprom.write_u32(100, 0xABCD);
+
+        // New record should be placed right at frontier
+        TEST_ASSERT_EQUAL(0xCD, eeprom.flash.memory[expected + 4]);
+        TEST_ASSERT_EQUAL(0xABCD, eeprom.read_u32(100, 0));
+    }
+}
+
+void test_mount_benchmark() {
+    uint32_t fills[] = { 0, CAPACITY / 4, CAPACITY / 2, CAPACITY };
+
+    for (uint32_t f = 0; f < sizeof(fills) / sizeof(fills[0]); f++)
+    {
+        Eeprom eeprom;
+        prepare(eeprom, fills[f]);
+
+        Eeprom::Item items[SETTINGS];
+        for (uint16_t i = 0; i < SETTINGS; i++) items[i] = Eeprom::item_u32(i, 0);
+
+        eeprom.flash.reset_stats();
+        eeprom.mount();
+        uint32_t mount_reads = eeprom.flash.total().reads;
+
+        eeprom.read_batch(items, SETTINGS);
+        uint32_t load_reads = eeprom.flash.total().reads - mount_reads;
+
+        // Headers of both banks (4 + 4) + binary search (log2 of slots,
+        // 4 reads per probe)
+        TEST_ASSERT_LESS_OR_EQUAL(4 + 4 + 4 * 8, mount_reads);
+
+        // Wall time of mount + load, averaged
+        enum { RUNS = 1000 };
+        auto start = std::chrono::steady_clock::now();
+
+        for (int r = 0; r < RUNS; r++)
+        {
+            Eeprom e;
+            for (uint32_t i = 0; i < sizeof(e.flash.memory); i++) e.flash.memory[i] = eeprom.flash.memory[i];
+            e.read_batch(items, SETTINGS);
+        }
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count() / RUNS;
+
+        printf(
+            "  %3d records: mount %d reads, load %d settings %d reads, %d ns (incl. flash copy)\n",
+            (int)fills[f], (int)mount_reads, (int)SETTINGS, (int)load_reads, (int)ns
+        );
+    }
+}
+
+static void put_u16(Eeprom & eeprom, uint8_t bank, uint32_t ofs, uint16_t val)
+{
+    uint8_t * m = eeprom.flash.memory + bank * Driver::BankSize + ofs;
+
+    m[0] = val & 0xFF;
+    m[1] = val >> 8;
+}
+
+// Power lost between new bank marker and dirty mark of old one. Both banks
+// are active, newer generation should win, with wrap.
+void test_mount_both_active() {
+    const uint16_t cases[][3] = {
+        // gen 0, gen 1, newer bank
+        { 0, 1, 1 },
+        { 0xFFFE, 0, 1 },
+        { 2, 1, 0 },
+        { 0, 0xFFFE, 0 }
+    };
+
+    for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        Eeprom eeprom;
+
+        for (uint8_t bank = 0; bank < 2; bank++)
+        {
+            put_u16(eeprom, bank, 0, 0x77EE);
+            put_u16(eeprom, bank, 2, cases[c][bank]);
+            // Record [0x55AA, 0, 10 + bank, 0]
+            put_u16(eeprom, bank, 8, 0x55AA);
+            put_u16(eeprom, bank, 10, 0);
+            put_u16(eeprom, bank, 12, 10 + bank);
+            put_u16(eeprom, bank, 14, 0);
+        }
+
+        uint8_t newer = (uint8_t)cases[c][2];
+
+        TEST_ASSERT_EQUAL(10 + newer, eeprom.read_u32(0, 0));
+        TEST_ASSERT_EQUAL(cases[c][newer], eeprom.get_stats().generation);
+
+        // Old bank cleaned
+        TEST_ASSERT_EQUAL(1, eeprom.flash.stats[newer ^ 1].erases);
+        TEST_ASSERT_EQUAL(0, eeprom.flash.stats[newer].erases);
+
+        // Still works after remount
+        Eeprom remounted;
+        for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+            remounted.flash.memory[i] = eeprom.flash.memory[i];
+        }
+        TEST_ASSERT_EQUAL(10 + newer, remounted.read_u32(0, 0));
+    }
+}
+
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_mount_frontier);
+    RUN_TEST(test_mount_benchmark);
+    RUN_TEST(test_mount_both_active);
+    return UNITY_END();
+}
+
+#endif
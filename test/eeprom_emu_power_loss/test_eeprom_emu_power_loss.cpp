@@ -0,0 +1,205 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_mock.h"
+
+#include <stdio.h>
+
+// Random workload with single writes & batches. Power is cut after every
+// possible halfword program, then flash is mounted again and checked. Data
+// should be equal to state before interrupted operation or after it.
+
+enum {
+    KEYS = 6,
+    OPS = 400
+};
+
+typedef struct {
+    uint32_t values[KEYS];
+} model_t;
+
+static uint32_t rnd_state;
+
+static uint32_t rnd()
+{
+    // xorshift32
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+// Run single operation, update model.
+template <typename DRIVER>
+static void run_op(EepromEmu<DRIVER> & eeprom, model_t & model)
+{
+    typedef EepromEmu<DRIVER> Eeprom;
+
+    // Small values set, to hit "skip the same" paths sometimes
+    if (rnd() % 3)
+    {
+        uint16_t addr = rnd() % KEYS;
+        uint32_t val = rnd() % 8;
+
+        eeprom.write_u32(addr, val);
+        model.values[addr] = val;
+        return;
+    }
+
+    typename Eeprom::Item items[KEYS];
+    uint8_t count = 1 + rnd() % KEYS;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        items[i] = Eeprom::item_u32((i + rnd()) % KEYS, rnd() % 8);
+    }
+
+    eeprom.write_batch(items, count);
+
+    for (uint8_t i = 0; i < count; i++) model.values[items[i].addr] = items[i].value;
+}
+
+template <typename DRIVER>
+static bool model_equal(EepromEmu<DRIVER> & eeprom, model_t & model)
+{
+    for (uint16_t i = 0; i < KEYS; i++)
+    {
+        if (eeprom.read_u32(i, UINT32_MAX) != model.values[i]) return false;
+    }
+    return true;
+}
+
+template <uint32_t UNIT, uint32_t MAPPED = 0>
+static void check_power_loss(uint32_t seed)
+{
+    typedef EepromFlashDriverMock<UNIT, MAPPED> Driver;
+
+    static model_t models[OPS + 1];
+    static uint32_t halfwords_done[OPS + 1];
+
+    //
+    // Reference run, remember model after every operation
+    //
+    EepromEmu<Driver> ref;
+    rnd_state = seed;
+
+    for (uint16_t i = 0; i < KEYS; i++) models[0].values[i] = UINT32_MAX;
+
+    ref.read_u32(0, 0); // Mount before counting
+    halfwords_done[0] = ref.flash.total().halfwords;
+
+    for (uint32_t op = 1; op <= OPS; op++)
+    {
+        models[op] = models[op - 1];
+        run_op(ref, models[op]);
+        halfwords_done[op] = ref.flash.total().halfwords;
+
+        TEST_ASSERT_TRUE(model_equal(ref, models[op]));
+    }
+
+    TEST_ASSERT_EQUAL(0, ref.flash.program_errors);
+
+    typename Driver::Stats t = ref.flash.total();
+    printf(
+        "  unit %d: %d ops, %d reads, %d programs, %d halfwords, %d erases\n",
+        (int)UNIT, (int)OPS, (int)t.reads, (int)t.programs, (int)t.halfwords, (int)t.erases
+    );
+
+    //
+    // Cut power at every halfword & check recovery
+    //
+    for (uint32_t cut = halfwords_done[0]; cut < halfwords_done[OPS]; cut++)
+    {
+        EepromEmu<Driver> eeprom;
+        model_t model = models[0];
+        rnd_state = seed;
+
+        eeprom.read_u32(0, 0);
+        eeprom.flash.power_cut_after(cut - halfwords_done[0]);
+
+        uint32_t op = 0;
+
+        while (!eeprom.flash.power_lost()) run_op(eeprom, model), op++;
+
+        // Operation `op` was interrupted, unless cut was exactly at its end
+        if (halfwords_done[op] == cut) continue;
+
+        EepromEmu<Driver> recovered;
+        for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+            recovered.flash.memory[i] = eeprom.flash.memory[i];
+        }
+
+        bool ok = model_equal(recovered, models[op - 1]) || model_equal(recovered, models[op]);
+
+        if (!ok) printf("  unit %d: failed at halfword %d (op %d)\n", (int)UNIT, (int)cut, (int)op);
+        TEST_ASSERT_TRUE(ok);
+
+        // Should continue to work after recovery
+        recovered.write_u32(0, 12345);
+        TEST_ASSERT_EQUAL(12345, recovered.read_u32(0, 0));
+        TEST_ASSERT_EQUAL(0, recovered.flash.program_errors);
+    }
+}
+
+void test_power_loss_halfword() {
+    check_power_loss<2>(1);
+    check_power_loss<2>(777);
+}
+
+void test_power_loss_word() {
+    check_power_loss<4>(1);
+    check_power_loss<4>(777);
+}
+
+void test_power_loss_mapped() {
+    check_power_loss<2, 1>(1);
+    check_power_loss<4, 1>(1);
+}
+
+// F0 programs word units by halfwords, mark first. Cut between those leaves
+// [0x55AA, 0xFFFF, value], which is not a write to address 0xFFFF and should
+// not be copied on bank move.
+void test_power_loss_torn_commit() {
+    typedef EepromEmu<EepromFlashDriverMock<4>> Eeprom;
+
+    Eeprom eeprom;
+    eeprom.write_u32(0, 1);
+
+    // Value unit (2 halfwords), then low half of [mark, address] unit
+    eeprom.flash.power_cut_after(3);
+    eeprom.write_u32(1, 0x12345678);
+
+    Eeprom recovered;
+    for (uint32_t i = 0; i < sizeof(eeprom.flash.memory); i++) {
+        recovered.flash.memory[i] = eeprom.flash.memory[i];
+    }
+
+    TEST_ASSERT_EQUAL_HEX32(0xAAAA, recovered.read_u32(0xFFFF, 0xAAAA));
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, recovered.read_u32(1, UINT32_MAX));
+
+    for (uint32_t i = 0; recovered.get_stats().generation < 2; i++) recovered.write_u32(0, i);
+
+    const uint16_t * mem = (const uint16_t *)recovered.flash.memory;
+
+    for (uint32_t i = 4; i < sizeof(recovered.flash.memory) / 2; i += 4)
+    {
+        if (mem[i] != 0xFFFF) TEST_ASSERT_TRUE(mem[i + 1] != 0xFFFF);
+    }
+
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, recovered.read_u32(1, UINT32_MAX));
+    TEST_ASSERT_EQUAL(0, recovered.flash.program_errors);
+}
+
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_power_loss_halfword);
+    RUN_TEST(test_power_loss_word);
+    RUN_TEST(test_power_loss_mapped);
+    RUN_TEST(test_power_loss_torn_commit);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_file.h"
+
+#include <stdio.h>
+#include <chrono>
+
+// Driver needs mmap, nothing to test on other hosts
+#ifdef EEPROM_FLASH_DRIVER_FILE
+
+typedef EepromEmu<EepromFlashDriverFile> Eeprom;
+
+static const char * image_path = "test_eeprom_image.bin";
+
+
+void test_file_program_erase() {
+    unlink(image_path);
+
+    EepromFlashDriverFile flash;
+    TEST_ASSERT_TRUE(flash.open(image_path));
+
+    // New image is erased
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, flash.read_u16(0, 0));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, flash.read_u16(1, flash.BankSize - 2));
+
+    // Program clears bits only
+    flash.write_u16(0, 0, 0x00FF);
+    flash.write_u16(0, 0, 0xFF0F);
+    TEST_ASSERT_EQUAL_HEX16(0x000F, flash.read_u16(0, 0));
+
+    flash.write_u16(1, 0, 0x1234);
+    flash.erase(0);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, flash.read_u16(0, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, flash.read_u16(1, 0));
+
+    flash.close();
+    unlink(image_path);
+}
+
+void test_file_persist() {
+    unlink(image_path);
+
+    {
+        Eeprom eeprom;
+        eeprom.flash.open(image_path);
+
+        // Force bank move too
+        for (uint32_t i = 0; i < 300; i++) eeprom.write_u32(i % 3, i);
+    }
+
+    Eeprom eeprom;
+    eeprom.flash.open(image_path);
+
+    TEST_ASSERT_EQUAL(297, eeprom.read_u32(0, 0));
+    TEST_ASSERT_EQUAL(298, eeprom.read_u32(1, 0));
+    TEST_ASSERT_EQUAL(299, eeprom.read_u32(2, 0));
+
+    unlink(image_path);
+}
+
+static uint32_t elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+}
+
+// Mount & compaction timing on flash image. Set `EEPROM_IMAGE` to use a dump
+// from device, it is copied and not modified. Otherwise synthetic image is
+// generated.
+void test_file_image_benchmark() {
+    const char * src = getenv("EEPROM_IMAGE");
+
+    unlink(image_path);
+
+    if (src)
+    {
+        FILE * in = fopen(src, "rb");
+        FILE * out = fopen(image_path, "wb");
+        TEST_ASSERT_NOT_NULL(in);
+        TEST_ASSERT_NOT_NULL(out);
+
+        int c;
+        while ((c = fgetc(in)) != EOF) fputc(c, out);
+
+        fclose(in);
+        fclose(out);
+    }
+    else
+    {
+        Eeprom eeprom;
+        eeprom.flash.open(image_path);
+
+        for (uint32_t i = 0; i < 120; i++) eeprom.write_u32(i % 8, i);
+    }
+
+    Eeprom eeprom;
+    eeprom.flash.open(image_path);
+
+    auto start = std::chrono::steady_clock::now();
+    eeprom.mount();
+    uint32_t mount_us = elapsed_us(start);
+
+    uint32_t generation = eeprom.get_stats().generation;
+
+    // Write until bank move, and time the move only
+    uint32_t move_us = 0;
+
+    for (uint32_t i = 0; generation == eeprom.get_stats().generation; i++)
+    {
+        start = std::chrono::steady_clock::now();
+        eeprom.write_u32(0xFF00 - 1, i);
+        move_us = elapsed_us(start);
+    }
+
+    printf(
+        "  image %s: mount %d us, compaction %d us, %d bytes copied\n",
+        src ? src : "(synthetic)",
+        (int)mount_us,
+        (int)move_us,
+        (int)eeprom.get_stats().compaction_bytes
+    );
+
+    unlink(image_path);
+}
+
+
+#endif
+
+
+int main() {
+    UNITY_BEGIN();
+#ifdef EEPROM_FLASH_DRIVER_FILE
+    RUN_TEST(test_file_program_erase);
+    RUN_TEST(test_file_persist);
+    RUN_TEST(test_file_image_benchmark);
+#endif
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,263 @@
+#ifdef UNIT_TEST
+
+// GUI regression tests, with headless HAL (`pio test -e headless`).
+//
+// Script drives the app via keys, and frame checksums are compared with
+// `golden.txt` records. Missing record is a failure. On mismatch, actual
+// frame is saved next to this file as `<name>.actual.ppm`.
+//
+// To record new frames or accept intended UI changes, run with
+// `GOLDEN_RECORD=1` env variable. Then missing & different records are
+// written to `golden.txt`, and such tests are reported as ignored.
+//
+// Tests share one app instance and run in order, as user would press keys.
+
+#include <unity.h>
+
+#include "app.h"
+#include "app_hal.h"
+#include "display_sleep.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char test_dir[256];
+
+static void golden_path(char * buf, size_t size, const char * name)
+{
+    snprintf(buf, size, "%s%s", test_dir, name);
+}
+
+static bool golden_find(const char * name, uint32_t * crc)
+{
+    char path[300];
+    char line[128];
+    bool found = false;
+
+    golden_path(path, sizeof(path), "golden.txt");
+
+    FILE * f = fopen(path, "r");
+    if (!f) return false;
+
+    while (!found && fgets(line, sizeof(line), f))
+    {
+        char key[64];
+        unsigned value;
+
+        if (sscanf(line, "%63s %x", key, &value) == 2 && !strcmp(key, name))
+        {
+            *crc = value;
+            found = true;
+        }
+    }
+
+    fclose(f);
+    return found;
+}
+
+// Replace or add record, other lines are kept
+static void golden_store(const char * name, uint32_t crc)
+{
+    char path[300];
+    char tmp[310];
+    char line[128];
+    bool stored = false;
+
+    golden_path(path, sizeof(path), "golden.txt");
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    FILE * src = fopen(path, "r");
+    FILE * dst = fopen(tmp, "w");
+    TEST_ASSERT_NOT_NULL(dst);
+
+    while (src && fgets(line, sizeof(line), src))
+    {
+        char key[64];
+
+        if (sscanf(line, "%63s", key) == 1 && !strcmp(key, name))
+        {
+            if (!stored) fprintf(dst, "%s %08x\n", name, (unsigned)crc);
+            stored = true;
+            continue;
+        }
+
+        fputs(line, dst);
+    }
+
+    if (!stored) fprintf(dst, "%s %08x\n", name, (unsigned)crc);
+
+    if (src) fclose(src);
+    TEST_ASSERT_EQUAL(0, fclose(dst));
+
+    remove(path);
+    TEST_ASSERT_EQUAL(0, rename(tmp, path));
+}
+
+static void check_frame(const char * name)
+{
+    uint32_t crc = hal::headless_frame_crc();
+    uint32_t expected;
+    char path[300];
+    char msg[400];
+    bool found = golden_find(name, &expected);
+
+    if (found && crc == expected) return;
+
+    if (getenv("GOLDEN_RECORD"))
+    {
+        golden_store(name, crc);
+        TEST_IGNORE_MESSAGE("Golden checksum recorded");
+    }
+
+    if (!found)
+    {
+        snprintf(msg, sizeof(msg), "No golden checksum for \"%s\", run with GOLDEN_RECORD=1", name);
+        TEST_FAIL_MESSAGE(msg);
+    }
+
+    snprintf(msg, sizeof(msg), "%s.actual.ppm", name);
+    golden_path(path, sizeof(path), msg);
+    hal::headless_frame_save(path);
+
+    snprintf(msg, sizeof(msg), "Frame \"%s\" differs, see %s", name, path);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+static bool frame_is_black()
+{
+    const uint16_t * frame = hal::headless_frame();
+
+    for (uint32_t i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX; i++)
+    {
+        if (frame[i]) return false;
+    }
+
+    return true;
+}
+
+
+void test_screen_dose()
+{
+    hal::headless_run(1000);
+
+    TEST_ASSERT_TRUE(hal::headless_backlight() > 0);
+    check_frame("dose");
+}
+
+// Frame, updated with hardware scroll, is the same as full redraw
+void test_screen_dose_scroll()
+{
+    hal::headless_click(LV_KEY_DOWN);
+    hal::headless_click(LV_KEY_DOWN);
+    hal::headless_run(500);
+
+    uint32_t crc = hal::headless_frame_crc();
+
+    lv_obj_invalidate(lv_scr_act());
+    hal::headless_run(100);
+    TEST_ASSERT_EQUAL_HEX32(crc, hal::headless_frame_crc());
+
+    check_frame("dose_down_2");
+}
+
+// Scroll with every key press, and check each animation frame: pending
+// areas are drawn first (hardware scroll path), then compared with full
+// redraw of the same state.
+static void check_scroll_frames(uint32_t key, uint8_t presses)
+{
+    char msg[64];
+
+    for (uint8_t i = 0; i < presses; i++)
+    {
+        hal::headless_click(key);
+
+        for (uint32_t t = 0; t < 400; t += 10)
+        {
+            hal::headless_run(10);
+            lv_refr_now(NULL);
+
+            uint32_t crc = hal::headless_frame_crc();
+
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+
+            snprintf(msg, sizeof(msg), "press %u, %u ms", (unsigned)i, (unsigned)t);
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(crc, hal::headless_frame_crc(), msg);
+        }
+    }
+}
+
+// Intermediate frames too, including scrollbar. Returns to the same item.
+void test_screen_dose_scroll_frames()
+{
+    check_scroll_frames(LV_KEY_DOWN, 2);
+    check_scroll_frames(LV_KEY_UP, 2);
+
+    check_frame("dose_down_2");
+}
+
+// Short push switches mode
+void test_screen_flow()
+{
+    hal::headless_click(LV_KEY_ENTER);
+    hal::headless_run(500);
+
+    check_frame("flow");
+}
+
+// Long push opens settings
+void test_screen_settings()
+{
+    hal::headless_click(LV_KEY_ENTER, LV_INDEV_DEF_LONG_PRESS_TIME + 200);
+    hal::headless_run(500);
+    check_frame("settings");
+}
+
+void test_screen_settings_select()
+{
+    hal::headless_click(LV_KEY_DOWN);
+    hal::headless_run(500);
+    check_frame("settings_down_1");
+}
+
+// Display sleeps when idle, wake press is not passed to UI
+void test_sleep_wake()
+{
+    uint32_t crc = hal::headless_frame_crc();
+
+    hal::headless_run(DISPLAY_SLEEP_DELAY + 1000);
+    TEST_ASSERT_EQUAL(0, hal::headless_backlight());
+    TEST_ASSERT_TRUE(frame_is_black());
+
+    hal::headless_click(LV_KEY_DOWN);
+    hal::headless_run(500);
+    TEST_ASSERT_TRUE(hal::headless_backlight() > 0);
+    TEST_ASSERT_EQUAL_HEX32(crc, hal::headless_frame_crc());
+}
+
+
+int main()
+{
+    const char * slash = strrchr(__FILE__, '/');
+    size_t len = slash ? (size_t)(slash - __FILE__ + 1) : 0;
+
+    if (len >= sizeof(test_dir)) len = 0;
+
+    memcpy(test_dir, __FILE__, len);
+    test_dir[len] = 0;
+
+    app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_screen_dose);
+    RUN_TEST(test_screen_dose_scroll);
+    RUN_TEST(test_screen_dose_scroll_frames);
+    RUN_TEST(test_screen_flow);
+    RUN_TEST(test_screen_settings);
+    RUN_TEST(test_screen_settings_select);
+    RUN_TEST(test_sleep_wake);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "key_queue.h"
+
+static key_event_t ev(uint32_t key, bool pressed, uint32_t time)
+{
+    key_event_t e = { key, time, pressed };
+    return e;
+}
+
+
+void test_fifo_order()
+{
+    KeyQueue<4> q;
+    key_event_t e;
+
+    TEST_ASSERT_TRUE(q.empty());
+    TEST_ASSERT_FALSE(q.pop(e));
+
+    TEST_ASSERT_TRUE(q.push(ev(17, true, 100)));
+    TEST_ASSERT_TRUE(q.push(ev(17, false, 150)));
+    TEST_ASSERT_FALSE(q.empty());
+
+    TEST_ASSERT_TRUE(q.pop(e));
+    TEST_ASSERT_EQUAL(17, e.key);
+    TEST_ASSERT_TRUE(e.pressed);
+    TEST_ASSERT_EQUAL(100, e.time);
+
+    TEST_ASSERT_TRUE(q.pop(e));
+    TEST_ASSERT_FALSE(e.pressed);
+    TEST_ASSERT_EQUAL(150, e.time);
+
+    TEST_ASSERT_TRUE(q.empty());
+}
+
+// Fast clicks between reads are kept, not merged to the last state
+void test_fast_clicks_not_lost()
+{
+    KeyQueue<8> q;
+    key_event_t e;
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        q.push(ev(i, true, i * 20));
+        q.push(ev(i, false, i * 20 + 10));
+    }
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_TRUE(q.pop(e));
+        TEST_ASSERT_EQUAL(i, e.key);
+        TEST_ASSERT_TRUE(e.pressed);
+        TEST_ASSERT_TRUE(q.pop(e));
+        TEST_ASSERT_EQUAL(i, e.key);
+        TEST_ASSERT_FALSE(e.pressed);
+    }
+
+    TEST_ASSERT_FALSE(q.pop(e));
+}
+
+void test_overflow_drops_newest()
+{
+    KeyQueue<4> q;
+    key_event_t e;
+
+    for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(q.push(ev(i, true, 0)));
+
+    TEST_ASSERT_FALSE(q.push(ev(99, true, 0)));
+    TEST_ASSERT_EQUAL(1, q.overflows);
+
+    TEST_ASSERT_TRUE(q.pop(e));
+    TEST_ASSERT_EQUAL(0, e.key);
+    TEST_ASSERT_TRUE(q.push(ev(4, true, 0)));
+
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        TEST_ASSERT_TRUE(q.pop(e));
+        TEST_ASSERT_EQUAL(i, e.key);
+    }
+}
+
+// Counters wrap at 256, ring must continue to work
+void test_index_wrap()
+{
+    KeyQueue<8> q;
+    key_event_t e;
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        TEST_ASSERT_TRUE(q.push(ev(i, true, i)));
+        TEST_ASSERT_TRUE(q.push(ev(i, false, i)));
+        TEST_ASSERT_TRUE(q.pop(e));
+        TEST_ASSERT_EQUAL(i, e.key);
+        TEST_ASSERT_TRUE(q.pop(e));
+        TEST_ASSERT_EQUAL(i, e.key);
+    }
+
+    TEST_ASSERT_TRUE(q.empty());
+    TEST_ASSERT_EQUAL(0, q.overflows);
+}
+
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fifo_order);
+    RUN_TEST(test_fast_clicks_not_lost);
+    RUN_TEST(test_overflow_drops_newest);
+    RUN_TEST(test_index_wrap);
+    return UNITY_END();
+}
+
+#endif
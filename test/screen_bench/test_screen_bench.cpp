@@ -0,0 +1,175 @@
+#ifdef UNIT_TEST
+
+// Per-screen render & heap benchmark, with headless HAL
+// (`pio test -e headless -f screen_bench`).
+//
+// For every screen reports objects created, LVGL heap use (peak while
+// created & shown, final after navigation steps, left after destroy),
+// fragmentation, time to create & render the first full frame, and render
+// time per navigation step.
+//
+// Heap has the real LV_MEM_SIZE, but pointers are 64-bit on host, so objects
+// take more space than on MCU. Times are host CPU ones. Use both to compare
+// changes, not as device numbers.
+//
+// Free heap at peak (app total, not screen only) is reported against
+// BENCH_HEAP_MARGIN % of LV_MEM_SIZE, but not checked - host numbers are
+// bigger than device ones. Fails only if allocation fails. Peak is exact on
+// Linux only, where every allocation is tracked (see `headless_heap_peak()`).
+
+#include <unity.h>
+
+#include "app.h"
+#include "app_hal.h"
+#include "screen_dose.h"
+#include "screen_flow.h"
+#include "screen_settings.h"
+
+#include <stdio.h>
+
+#define BENCH_STEPS 8
+
+#ifndef BENCH_HEAP_MARGIN
+#define BENCH_HEAP_MARGIN 10
+#endif
+
+typedef struct {
+    const char * name;
+    void (*create)();
+    void (*destroy)();
+    // Key for navigation step
+    uint32_t step_key;
+} bench_screen_t;
+
+static uint32_t heap_used(lv_mem_monitor_t * mon)
+{
+    lv_mem_monitor(mon);
+    return mon->total_size - mon->free_size;
+}
+
+static void bench(const bench_screen_t & s)
+{
+    lv_mem_monitor_t mon;
+
+    // Let previous screen animations & redraws finish
+    hal::headless_run(1000);
+
+    uint32_t base_used = heap_used(&mon);
+    uint16_t base_objs = lv_obj_count_children_recursive(lv_scr_act());
+
+    hal::headless_heap_peak_reset();
+
+    uint32_t started_at = hal::micros();
+    s.create();
+    uint32_t create_us = hal::micros() - started_at;
+
+    uint32_t created_used = heap_used(&mon);
+    uint16_t objs = lv_obj_count_children_recursive(lv_scr_act()) - base_objs;
+
+    lv_refr_now(NULL);
+    uint32_t frame_us = hal::micros() - started_at;
+
+    uint32_t step_sum = 0;
+    uint32_t step_max = 0;
+
+    for (int i = 0; i < BENCH_STEPS; i++)
+    {
+        uint32_t busy_us = hal::headless_busy_us();
+
+        hal::headless_click(s.step_key);
+        hal::headless_run(500);
+
+        uint32_t step_us = hal::headless_busy_us() - busy_us;
+
+        step_sum += step_us;
+        step_max = LV_MATH_MAX(step_max, step_us);
+    }
+
+    uint32_t peak_total = LV_MATH_MAX(hal::headless_heap_peak(), created_used);
+    uint32_t peak = peak_total - base_used;
+    uint32_t final_used = heap_used(&mon) - base_used;
+    uint8_t frag_pct = mon.frag_pct;
+    uint32_t free_biggest = mon.free_biggest_size;
+
+    s.destroy();
+    hal::headless_run(100);
+
+    int32_t left = (int32_t)heap_used(&mon) - (int32_t)base_used;
+
+    printf(
+        "[Bench] %s: %d objects, heap peak: %d (total %d), final: %d, left: %d bytes, "
+        "frag: %d%%, free block: %d of %d bytes\n",
+        s.name,
+        (int)objs,
+        (int)peak,
+        (int)peak_total,
+        (int)final_used,
+        (int)left,
+        (int)frag_pct,
+        (int)free_biggest,
+        (int)mon.total_size
+    );
+
+    printf(
+        "[Bench] %s: first frame: %d us (create: %d us), step: avg %d us, max %d us\n",
+        s.name,
+        (int)frame_us,
+        (int)create_us,
+        (int)(step_sum / BENCH_STEPS),
+        (int)step_max
+    );
+
+    int32_t free_pct = 100 - (int32_t)(peak_total * 100 / LV_MEM_SIZE);
+
+    printf(
+        "[Bench] %s: free at peak: %d%% (margin %d%%)%s\n",
+        s.name,
+        (int)free_pct,
+        (int)BENCH_HEAP_MARGIN,
+        free_pct < BENCH_HEAP_MARGIN ? " - LOW, check on device" : ""
+    );
+
+    TEST_ASSERT_TRUE(objs > 0);
+}
+
+// LVGL can't continue without memory, stop test with report
+static void heap_fail(uint32_t size)
+{
+    char msg[100];
+    snprintf(msg, sizeof(msg), "Heap exhausted, failed to allocate %d bytes", (int)size);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+
+void test_screen_dose()
+{
+    bench({ "dose", screen_dose_create, screen_dose_destroy, LV_KEY_DOWN });
+}
+
+void test_screen_flow()
+{
+    bench({ "flow", screen_flow_create, screen_flow_destroy, LV_KEY_RIGHT });
+}
+
+void test_screen_settings()
+{
+    bench({ "settings", screen_settings_create, screen_settings_destroy, LV_KEY_DOWN });
+}
+
+
+int main()
+{
+    app_init();
+    // Screens are created by benchmark
+    app_screen_destroy();
+
+    hal::headless_heap_fail_cb(heap_fail);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_screen_dose);
+    RUN_TEST(test_screen_flow);
+    RUN_TEST(test_screen_settings);
+    return UNITY_END();
+}
+
+#endif
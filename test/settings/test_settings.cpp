@@ -0,0 +1,144 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "eeprom_emu.h"
+#include "eeprom_flash_driver_mock.h"
+#include "settings.h"
+
+typedef EepromEmu<EepromFlashDriverMock<2>> Eeprom;
+
+static struct {
+    float dia;
+    bool flag;
+    uint8_t level;
+} data;
+
+static const auto schema = std::make_tuple(
+    SETTING(0, data.dia, 15.0f, 4.0f, 30.0f),
+    SETTING(1, data.flag, false, false, true),
+    SETTING(2, data.level, 100, 0, 100)
+);
+
+typedef SettingsStore<Eeprom, decltype(schema)> Store;
+
+
+void test_settings_defaults() {
+    Eeprom eeprom;
+    Store settings(eeprom, schema);
+
+    settings.load();
+
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, data.dia);
+    TEST_ASSERT_FALSE(data.flag);
+    TEST_ASSERT_EQUAL(100, data.level);
+
+    // Nothing changed => nothing written
+    eeprom.flash.reset_stats();
+    settings.save();
+    TEST_ASSERT_EQUAL(0, eeprom.flash.total().programs);
+}
+
+void test_settings_save_changed_only() {
+    Eeprom eeprom;
+    Store settings(eeprom, schema);
+
+    settings.load();
+
+    data.level = 50;
+    eeprom.flash.reset_stats();
+    settings.save();
+
+    // Single record
+    TEST_ASSERT_EQUAL(4, eeprom.flash.total().programs);
+
+    data.dia = 20.0f;
+    data.flag = true;
+    settings.save();
+
+    Store settings2(eeprom, schema);
+    data.dia = 0.0f;
+    data.flag = false;
+    data.level = 0;
+    settings2.load();
+
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, data.dia);
+    TEST_ASSERT_TRUE(data.flag);
+    TEST_ASSERT_EQUAL(50, data.level);
+}
+
+void test_settings_pending() {
+    Eeprom eeprom;
+    Store settings(eeprom, schema);
+
+    settings.load();
+    TEST_ASSERT_EQUAL(0, settings.pending());
+
+    data.dia = 20.0f;
+    data.level = 10;
+    TEST_ASSERT_EQUAL(2, settings.pending());
+
+    settings.save();
+    TEST_ASSERT_EQUAL(0, settings.pending());
+}
+
+void test_settings_bounds() {
+    Eeprom eeprom;
+    Store settings(eeprom, schema);
+
+    eeprom.write_float(0, 100.0f);
+    eeprom.write_u32(2, 255);
+
+    settings.load();
+
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, data.dia);
+    TEST_ASSERT_EQUAL(100, data.level);
+
+    // Broken float => default, big integer => clamped, not truncated
+    eeprom.write_u32(0, 0x7FC00000);
+    eeprom.write_u32(2, 0x100);
+
+    settings.load();
+
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, data.dia);
+    TEST_ASSERT_EQUAL(100, data.level);
+}
+
+// Failed write keeps values pending, and next save retries
+void test_settings_save_failed() {
+    Eeprom eeprom;
+    Store settings(eeprom, schema);
+    uint8_t blob[Eeprom::BLOB_MAX_SIZE] = { 0 };
+
+    settings.load();
+
+    // Fill bank with live data
+    eeprom.write_blob(0, blob, sizeof(blob));
+    for (uint16_t addr = 100; eeprom.write_u32(addr, addr); addr++) {}
+
+    data.level = 50;
+    TEST_ASSERT_FALSE(settings.save());
+    TEST_ASSERT_EQUAL(1, settings.pending());
+
+    // Free space & retry
+    eeprom.write_blob(0, blob, 4);
+    TEST_ASSERT_TRUE(settings.save());
+    TEST_ASSERT_EQUAL(0, settings.pending());
+
+    data.level = 0;
+    settings.load();
+    TEST_ASSERT_EQUAL(50, data.level);
+}
+
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_settings_defaults);
+    RUN_TEST(test_settings_save_changed_only);
+    RUN_TEST(test_settings_pending);
+    RUN_TEST(test_settings_bounds);
+    RUN_TEST(test_settings_save_failed);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,218 @@
+#ifdef UNIT_TEST
+
+#include <unity.h>
+
+#include "stepper_control.h"
+
+// Records coil outputs. `phases` keeps phase changes only, to check motion
+// direction.
+struct MockIO
+{
+    static int state;           // energized phase, -1 if off
+    static uint8_t phases[64];
+    static uint8_t phases_count;
+
+    static void reset()
+    {
+        state = -1;
+        phases_count = 0;
+    }
+
+    void to(uint16_t phase)
+    {
+        if (!phases_count || phases[phases_count - 1] != phase)
+        {
+            if (phases_count < sizeof(phases)) phases[phases_count++] = (uint8_t)phase;
+        }
+        state = phase;
+    }
+
+    void off() { state = -1; }
+};
+
+int MockIO::state = -1;
+uint8_t MockIO::phases[64];
+uint8_t MockIO::phases_count = 0;
+
+
+void test_stepper_move()
+{
+    StepperPwmParams params;
+    Stepper<MockIO> stepper(&params);
+
+    MockIO::reset();
+
+    // Nothing requested => coils stay off
+    for (int i = 0; i < 10; i++) stepper.tick();
+    TEST_ASSERT_EQUAL(-1, MockIO::state);
+    TEST_ASSERT_TRUE(stepper.is_done());
+
+    // Request is applied on the next tick, with full phase value
+    stepper.go(2);
+    TEST_ASSERT_FALSE(stepper.is_done());
+
+    stepper.tick();
+    TEST_ASSERT_EQUAL(2, MockIO::state);
+    TEST_ASSERT_FALSE(stepper.is_done());
+
+    // Active pulse: mostly on, until done
+    uint32_t ticks = 1, on = 1;
+
+    while (!stepper.is_done() && ticks < 1000)
+    {
+        stepper.tick();
+        ticks++;
+        if (MockIO::state == 2) on++;
+    }
+
+    TEST_ASSERT_TRUE(ticks < 1000);
+    TEST_ASSERT_TRUE(on * 100 / ticks >= 80);
+
+    // Hold: low fill, the same phase
+    on = 0;
+
+    for (int i = 0; i < 100; i++)
+    {
+        stepper.tick();
+        if (MockIO::state == 2) on++;
+        else TEST_ASSERT_EQUAL(-1, MockIO::state);
+    }
+
+    TEST_ASSERT_EQUAL(100 * params.pwm_hold_active / (params.pwm_hold_active + params.pwm_hold_inactive), on);
+
+    stepper.off();
+    stepper.tick();
+    TEST_ASSERT_EQUAL(-1, MockIO::state);
+
+    for (int i = 0; i < 10; i++) stepper.tick();
+    TEST_ASSERT_EQUAL(-1, MockIO::state);
+}
+
+typedef StepperControl<MockIO> Control;
+
+static void run(Control & ctl, uint32_t ticks)
+{
+    for (uint32_t i = 0; i < ticks; i++) ctl.tick();
+}
+
+static void run_until_idle(Control & ctl)
+{
+    for (uint32_t i = 0; i < 100000 && !ctl.is_idle(); i++) ctl.tick();
+
+    TEST_ASSERT_TRUE(ctl.is_idle());
+}
+
+void test_control_fast_forward()
+{
+    StepperPwmParams params;
+    Control ctl(&params);
+    const uint8_t expected[] = { 1, 2, 3, 0, 1 };
+
+    MockIO::reset();
+
+    ctl.fast_forward();
+    run(ctl, ctl.retract_pulse_period * 5);
+
+    TEST_ASSERT_EQUAL(sizeof(expected), MockIO::phases_count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, MockIO::phases, sizeof(expected));
+
+    ctl.stop();
+    run_until_idle(ctl);
+    TEST_ASSERT_EQUAL(sizeof(expected), MockIO::phases_count);
+}
+
+void test_control_fast_back()
+{
+    StepperPwmParams params;
+    Control ctl(&params);
+    const uint8_t expected[] = { 3, 2, 1, 0, 3 };
+
+    MockIO::reset();
+
+    ctl.fast_back();
+    run(ctl, ctl.retract_pulse_period * 5);
+
+    TEST_ASSERT_EQUAL(sizeof(expected), MockIO::phases_count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, MockIO::phases, sizeof(expected));
+}
+
+// Unretract forward, flow forward, retract back on stop
+void test_control_flow()
+{
+    StepperPwmParams params;
+    Control ctl(&params);
+    const uint8_t expected[] = { 1, 2, 3, 0, 1, 0, 3 };
+
+    MockIO::reset();
+
+    ctl.retract_steps = 2;
+    ctl.flow();
+    // Unretract steps are sent at ticks 0 & 20, flow ones at 41, 91, 141
+    run(ctl, ctl.retract_pulse_period * 2 + ctl.flow_pulse_period * 2 + 2);
+    TEST_ASSERT_FALSE(ctl.is_idle());
+
+    ctl.stop();
+    run_until_idle(ctl);
+
+    TEST_ASSERT_EQUAL(sizeof(expected), MockIO::phases_count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, MockIO::phases, sizeof(expected));
+}
+
+// Dose moves forward, retracts back and stops by itself
+void test_control_dose()
+{
+    StepperPwmParams params;
+    Control ctl(&params);
+
+    MockIO::reset();
+
+    ctl.retract_steps = 2;
+    ctl.dose_steps = 4;
+    ctl.dose();
+    run_until_idle(ctl);
+
+    uint8_t n = MockIO::phases_count;
+
+    TEST_ASSERT_TRUE(n > 2 * ctl.retract_steps);
+
+    // All forward, except the last retract steps
+    uint8_t prev = 0;
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        uint8_t step = (uint8_t)((MockIO::phases[i] - prev) & 3);
+
+        TEST_ASSERT_EQUAL(i < n - ctl.retract_steps ? 1 : 3, step);
+        prev = MockIO::phases[i];
+    }
+}
+
+// Dose request while flow switches to dose without unretract, and stops
+void test_control_flow_to_dose()
+{
+    StepperPwmParams params;
+    Control ctl(&params);
+
+    MockIO::reset();
+
+    ctl.flow();
+    run(ctl, 200);
+
+    ctl.dose();
+    run_until_idle(ctl);
+}
+
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_stepper_move);
+    RUN_TEST(test_control_fast_forward);
+    RUN_TEST(test_control_fast_back);
+    RUN_TEST(test_control_flow);
+    RUN_TEST(test_control_dose);
+    RUN_TEST(test_control_flow_to_dose);
+    return UNITY_END();
+}
+
+#endif